@@ -0,0 +1,90 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <chrono>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "fmt/format.h"
+
+#include "yy_values_aggregator.hpp"
+#include "yy_values_label_id.hpp"
+#include "yy_values_metric_data.hpp"
+#include "yy_values_metric_id.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+// Samples spread round robin over state.range(0) series, closing a
+// tumbling window each time every series has reported once.
+void BM_Aggregator_Add(benchmark::State & state)
+{
+  const auto num_series = static_cast<size_type>(state.range(0));
+
+  yy_quad::simple_vector<std::string> devices{};
+  devices.reserve(num_series);
+  for(size_type idx = 0; idx < num_series; ++idx)
+  {
+    devices.emplace_back(fmt::format("device_{}", idx));
+  }
+
+  Aggregator aggregator{AggregateConfig{std::chrono::seconds{1}, std::chrono::seconds{0}, AggregateFn::All},
+                        num_series};
+  MetricDataVector out{};
+
+  const auto device_label{intern_label("device")};
+
+  MetricData metric_data{};
+  metric_data.Id(MetricId{"temperature", "room"});
+  metric_data.Type(ValueType::Float);
+
+  size_type idx = 0;
+  int64_t window = 0;
+
+  for(auto _ : state)
+  {
+    metric_data.Labels().set_label(device_label, devices[idx]);
+    metric_data.Value("21.5");
+    metric_data.Binary(21.5);
+    metric_data.Status(ValueStatus::Ok);
+    metric_data.Timestamp(timestamp_type{std::chrono::seconds{window}});
+
+    aggregator.Add(metric_data, out);
+
+    if(++idx == num_series)
+    {
+      idx = 0;
+      ++window;
+      out.clear(yy_data::ClearAction::Keep);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["series"] = static_cast<double>(aggregator.Series());
+}
+
+BENCHMARK(BM_Aggregator_Add)->RangeMultiplier(10)->Range(1000, 1000000);
+
+} // namespace yafiyogi::yy_values::bench
@@ -0,0 +1,83 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "benchmark/benchmark.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_values_metric_spec.hpp"
+
+#include "yy_bench_util.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+void BM_ConfigureValues(benchmark::State & state)
+{
+  const auto num_values = static_cast<size_type>(state.range(0));
+  constexpr size_type num_handlers = 4;
+  auto yaml_values{YAML::Load(values_yaml(num_values, num_handlers))};
+
+  spdlog::set_level(spdlog::level::warn);
+
+  for(auto _ : state)
+  {
+    auto metrics{configure_values(yaml_values)};
+    benchmark::DoNotOptimize(metrics);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * num_handlers);
+}
+
+BENCHMARK(BM_ConfigureValues)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+// Builds Metrics from pre-parsed specs; arg 1 is the maximum number of
+// build threads.
+void BM_CreateMetrics(benchmark::State & state)
+{
+  const auto num_values = static_cast<size_type>(state.range(0));
+  const auto max_threads = static_cast<size_type>(state.range(1));
+  constexpr size_type num_handlers = 4;
+
+  spdlog::set_level(spdlog::level::warn);
+  const auto specs{configure_metric_specs(YAML::Load(values_yaml(num_values, num_handlers)))};
+
+  for(auto _ : state)
+  {
+    auto metrics{create_metrics(specs, nullptr, max_threads)};
+    benchmark::DoNotOptimize(metrics);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * num_handlers);
+}
+
+BENCHMARK(BM_CreateMetrics)
+->ArgsProduct({{100, 1000}, {1, 2, 4, 8, 16}})
+->ArgNames({"values", "threads"})
+->Unit(benchmark::kMillisecond)
+->UseRealTime();
+
+} // namespace yafiyogi::yy_values::bench
@@ -0,0 +1,92 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "fmt/format.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_values_dispatcher.hpp"
+
+#include "yy_bench_util.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+namespace {
+
+constexpr size_type g_num_handlers = 64;
+constexpr size_type g_num_events = 16384;
+
+} // anonymous namespace
+
+void BM_Dispatcher_Dispatch(benchmark::State & state)
+{
+  spdlog::set_level(spdlog::level::warn);
+
+  auto yaml_values{YAML::Load(values_yaml(4, g_num_handlers))};
+  MetricsDispatcher dispatcher{configure_values(yaml_values),
+                               static_cast<size_type>(state.range(0))};
+
+  yy_quad::simple_vector<std::string> handlers{};
+  yy_quad::simple_vector<std::string> topics{};
+  yy_quad::simple_vector<yy_mqtt::TopicLevelsView> levels{};
+  handlers.reserve(g_num_events);
+  topics.reserve(g_num_events);
+  levels.resize(g_num_events);
+  for(size_type idx = 0; idx < g_num_events; ++idx)
+  {
+    handlers.emplace_back(fmt::format("handler_{}", idx % g_num_handlers));
+    topics.emplace_back(device_topic(idx));
+    topic_levels(topics[idx], levels[idx]);
+  }
+
+  MetricDataVector metric_data{};
+
+  for(auto _ : state)
+  {
+    for(size_type idx = 0; idx < g_num_events; ++idx)
+    {
+      std::ignore = dispatcher.Add(handlers[idx],
+                                   MetricEvent{(idx & 1) ? "1" : "0",
+                                               topics[idx],
+                                               yy_data::observer_ptr<const yy_mqtt::TopicLevelsView>{&levels[idx]},
+                                               timestamp_type{},
+                                               ValueType::String});
+    }
+
+    dispatcher.Dispatch(MetricDataVectorPtr{&metric_data});
+    metric_data.clear(yy_data::ClearAction::Keep);
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_num_events));
+}
+
+BENCHMARK(BM_Dispatcher_Dispatch)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+} // namespace yafiyogi::yy_values::bench
@@ -0,0 +1,118 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "fmt/format.h"
+
+#include "yy_values_label_id.hpp"
+#include "yy_values_labels.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+namespace {
+
+yy_quad::simple_vector<LabelId> label_ids(size_type p_num_labels)
+{
+  yy_quad::simple_vector<LabelId> ids{};
+
+  ids.reserve(p_num_labels);
+  for(size_type idx = 0; idx < p_num_labels; ++idx)
+  {
+    ids.emplace_back(intern_label(fmt::format("label_{}", idx)));
+  }
+
+  return ids;
+}
+
+} // anonymous namespace
+
+void BM_Labels_SetLabel(benchmark::State & state)
+{
+  auto ids{label_ids(static_cast<size_type>(state.range(0)))};
+  const std::string value{"a reasonably long label value"};
+  Labels labels{};
+
+  for(auto _ : state)
+  {
+    labels.clear();
+    for(const auto & id : ids)
+    {
+      benchmark::DoNotOptimize(labels.set_label(id, value));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Labels_GetLabel(benchmark::State & state)
+{
+  auto ids{label_ids(static_cast<size_type>(state.range(0)))};
+  Labels labels{};
+
+  for(const auto & id : ids)
+  {
+    labels.set_label(id, id.Name());
+  }
+
+  for(auto _ : state)
+  {
+    for(const auto & id : ids)
+    {
+      benchmark::DoNotOptimize(labels.get_label(id));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_Labels_GetLabelByName(benchmark::State & state)
+{
+  auto ids{label_ids(static_cast<size_type>(state.range(0)))};
+  Labels labels{};
+
+  for(const auto & id : ids)
+  {
+    labels.set_label(id, id.Name());
+  }
+
+  for(auto _ : state)
+  {
+    for(const auto & id : ids)
+    {
+      benchmark::DoNotOptimize(labels.get_label(id.Name()));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Labels_SetLabel)->DenseRange(2, 20, 6);
+BENCHMARK(BM_Labels_GetLabel)->DenseRange(2, 20, 6);
+BENCHMARK(BM_Labels_GetLabelByName)->DenseRange(2, 20, 6);
+
+} // namespace yafiyogi::yy_values::bench
@@ -0,0 +1,133 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_values_metric.hpp"
+
+#include "yy_bench_util.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+namespace {
+
+constexpr size_type g_num_topics = 1024;
+constexpr size_type g_batch_size = 64;
+
+struct MetricFixture
+{
+    MetricFixture()
+    {
+      spdlog::set_level(spdlog::level::warn);
+
+      auto yaml_values{YAML::Load(values_yaml(1, 1))};
+      auto metrics{configure_values(yaml_values)};
+      auto [ignore_key, handler_metrics] = metrics[0];
+      metric = handler_metrics[0];
+
+      topics.reserve(g_num_topics);
+      levels.resize(g_num_topics);
+      for(size_type idx = 0; idx < g_num_topics; ++idx)
+      {
+        topics.emplace_back(device_topic(idx));
+        topic_levels(topics[idx], levels[idx]);
+      }
+    }
+
+    MetricPtr metric{};
+    yy_quad::simple_vector<std::string> topics{};
+    yy_quad::simple_vector<yy_mqtt::TopicLevelsView> levels{};
+};
+
+} // anonymous namespace
+
+void BM_Metric_Event(benchmark::State & state)
+{
+  MetricFixture fixture{};
+  const auto & metric = *fixture.metric;
+  auto context{metric.CreateContext()};
+  MetricDataVector metric_data{};
+  size_type idx = 0;
+
+  for(auto _ : state)
+  {
+    metric.Event(context,
+                 (idx & 1) ? "1" : "0",
+                 fixture.topics[idx],
+                 fixture.levels[idx],
+                 timestamp_type{},
+                 ValueType::String,
+                 MetricDataVectorPtr{&metric_data});
+
+    // Keep the output slots, as a consumer draining the vector would.
+    metric_data.clear(yy_data::ClearAction::Keep);
+    idx = (idx + 1) % g_num_topics;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Metric_Events(benchmark::State & state)
+{
+  MetricFixture fixture{};
+  const auto & metric = *fixture.metric;
+  auto context{metric.CreateContext()};
+  MetricDataVector metric_data{};
+
+  yy_quad::simple_vector<MetricEvent> events{};
+  events.reserve(g_num_topics);
+  for(size_type idx = 0; idx < g_num_topics; ++idx)
+  {
+    events.emplace_back(MetricEvent{(idx & 1) ? "1" : "0",
+                                    fixture.topics[idx],
+                                    yy_data::observer_ptr<const yy_mqtt::TopicLevelsView>{&fixture.levels[idx]},
+                                    timestamp_type{},
+                                    ValueType::String});
+  }
+
+  size_type idx = 0;
+  for(auto _ : state)
+  {
+    metric.Events(context,
+                  std::span<const MetricEvent>{events.data() + idx, g_batch_size},
+                  MetricDataVectorPtr{&metric_data});
+
+    metric_data.clear(yy_data::ClearAction::Keep);
+    idx = (idx + g_batch_size) % g_num_topics;
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(g_batch_size));
+}
+
+BENCHMARK(BM_Metric_Event);
+BENCHMARK(BM_Metric_Events);
+
+} // namespace yafiyogi::yy_values::bench
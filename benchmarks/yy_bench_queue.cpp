@@ -0,0 +1,179 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+
+#include "yy_values_metric_data.hpp"
+#include "yy_values_metric_data_queue.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+namespace {
+
+constexpr size_type g_num_items = 1 << 16;
+constexpr size_type g_capacity = 1024;
+
+// The baseline the queues replace: producers append under a lock and
+// the consumer swaps out the whole batch.
+class MutexMetricDataVector final
+{
+  public:
+    bool Push(MetricData & p_metric_data)
+    {
+      std::unique_lock lck{m_mtx};
+      m_metric_data.swap_data_back(p_metric_data);
+
+      return true;
+    }
+
+    void Drain(MetricDataVector & p_metric_data)
+    {
+      std::unique_lock lck{m_mtx};
+      std::swap(m_metric_data, p_metric_data);
+    }
+
+  private:
+    std::mutex m_mtx{};
+    MetricDataVector m_metric_data{};
+};
+
+template<typename Queue>
+void produce(Queue & p_queue,
+             size_type p_num_items)
+{
+  MetricData metric_data{};
+
+  for(size_type idx = 0; idx < p_num_items; ++idx)
+  {
+    metric_data.Value("21.5");
+    while(!p_queue.Push(metric_data))
+    {
+      std::this_thread::yield();
+    }
+  }
+}
+
+template<typename Queue>
+void run_queue(benchmark::State & state,
+               Queue & p_queue,
+               size_type p_num_producers)
+{
+  const size_type items_per_producer = g_num_items / p_num_producers;
+  const size_type total = items_per_producer * p_num_producers;
+
+  for(auto _ : state)
+  {
+    yy_quad::simple_vector<std::jthread> producers{};
+    producers.reserve(p_num_producers);
+    for(size_type idx = 0; idx < p_num_producers; ++idx)
+    {
+      producers.emplace_back([&p_queue, items_per_producer]() {
+        produce(p_queue, items_per_producer);
+      });
+    }
+
+    MetricData metric_data{};
+    for(size_type count = 0; count < total; ++count)
+    {
+      while(!p_queue.Pop(metric_data))
+      {
+        std::this_thread::yield();
+      }
+      benchmark::DoNotOptimize(metric_data.Value().data());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(total));
+}
+
+} // anonymous namespace
+
+void BM_Queue_Spsc(benchmark::State & state)
+{
+  MetricDataSpscQueue queue{g_capacity};
+
+  run_queue(state, queue, 1);
+}
+
+void BM_Queue_Mpsc(benchmark::State & state)
+{
+  MetricDataMpscQueue queue{g_capacity};
+
+  run_queue(state, queue, static_cast<size_type>(state.range(0)));
+}
+
+void BM_Queue_MutexVector(benchmark::State & state)
+{
+  const auto num_producers = static_cast<size_type>(state.range(0));
+  const size_type items_per_producer = g_num_items / num_producers;
+  const size_type total = items_per_producer * num_producers;
+
+  MutexMetricDataVector queue{};
+  MetricDataVector batch{};
+
+  for(auto _ : state)
+  {
+    yy_quad::simple_vector<std::jthread> producers{};
+    producers.reserve(num_producers);
+    for(size_type idx = 0; idx < num_producers; ++idx)
+    {
+      producers.emplace_back([&queue, items_per_producer]() {
+        produce(queue, items_per_producer);
+      });
+    }
+
+    for(size_type count = 0; count < total; )
+    {
+      queue.Drain(batch);
+      if(batch.empty())
+      {
+        std::this_thread::yield();
+        continue;
+      }
+
+      for(const auto & metric_data : batch)
+      {
+        benchmark::DoNotOptimize(metric_data.Value().data());
+      }
+      count += batch.size();
+      batch.clear(yy_data::ClearAction::Keep);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(total));
+}
+
+BENCHMARK(BM_Queue_Spsc)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Queue_Mpsc)->RangeMultiplier(2)->Range(1, 4)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Queue_MutexVector)->RangeMultiplier(2)->Range(1, 4)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+} // namespace yafiyogi::yy_values::bench
@@ -0,0 +1,83 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_label_actions.hpp"
+#include "yy_label_action_replace_path.hpp"
+#include "yy_values_label_id.hpp"
+#include "yy_values_labels.hpp"
+#include "yy_values_metric_labels.hpp"
+
+#include "yy_bench_util.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+namespace {
+
+constexpr size_type g_num_topics = 1024;
+
+} // anonymous namespace
+
+void BM_ReplacePath_Apply(benchmark::State & state)
+{
+  const auto num_patterns = static_cast<size_type>(state.range(0));
+  auto yaml_replace{YAML::Load(replace_yaml(num_patterns))};
+  const ReplacePathLabelAction action{intern_label("device"),
+                                      configure_label_action_replace_path(yaml_replace)};
+
+  yy_quad::simple_vector<std::string> topics{};
+  yy_quad::simple_vector<yy_mqtt::TopicLevelsView> levels{};
+  topics.reserve(g_num_topics);
+  levels.resize(g_num_topics);
+  for(size_type idx = 0; idx < g_num_topics; ++idx)
+  {
+    topics.emplace_back(device_topic(idx));
+    topic_levels(topics[idx], levels[idx]);
+  }
+
+  Labels labels_in{};
+  Labels labels_out{};
+  size_type idx = 0;
+
+  for(auto _ : state)
+  {
+    labels_in.set_label(g_label_topic_id, topics[idx]);
+    action.Apply(labels_in, levels[idx], labels_out);
+    benchmark::DoNotOptimize(labels_out);
+
+    idx = (idx + 1) % g_num_topics;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ReplacePath_Apply)->Arg(1)->Arg(10)->Arg(50)->Arg(100)->Arg(500);
+
+} // namespace yafiyogi::yy_values::bench
@@ -0,0 +1,140 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "fmt/format.h"
+
+#include "yy_value_action_switch.hpp"
+#include "yy_value_switch_table.hpp"
+#include "yy_values_metric_data.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+namespace {
+
+SwitchValueAction::Switch switch_values(size_type p_num_mappings)
+{
+  SwitchValueAction::Switch values{};
+
+  values.reserve(p_num_mappings);
+  for(size_type idx = 0; idx < p_num_mappings; ++idx)
+  {
+    values.emplace(fmt::format("status_{}", idx),
+                   fmt::format("state_{}", idx % 8));
+  }
+
+  return values;
+}
+
+// Every mapped input once, with a miss after every 7 hits.
+yy_quad::simple_vector<std::string> switch_inputs(size_type p_num_mappings)
+{
+  yy_quad::simple_vector<std::string> inputs{};
+  for(size_type idx = 0; idx < p_num_mappings; ++idx)
+  {
+    inputs.emplace_back(fmt::format("status_{}", idx));
+
+    if(6 == (idx % 7))
+    {
+      inputs.emplace_back(fmt::format("missing_{}", idx));
+    }
+  }
+
+  return inputs;
+}
+
+} // anonymous namespace
+
+void BM_Switch_Apply(benchmark::State & state)
+{
+  const auto num_mappings = static_cast<size_type>(state.range(0));
+  const SwitchValueAction action{std::string{"unknown"},
+                                 switch_values(num_mappings)};
+
+  const auto inputs{switch_inputs(num_mappings)};
+
+  MetricData metric_data{};
+  size_type idx = 0;
+
+  for(auto _ : state)
+  {
+    metric_data.Value(inputs[idx]);
+    action.Apply(metric_data, ValueType::String);
+    benchmark::DoNotOptimize(metric_data);
+
+    idx = (idx + 1) % inputs.size();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Switch_Apply)->RangeMultiplier(2)->Range(2, 2048);
+
+// Lookup alone, flat_map binary search against SwitchTable.
+void BM_Switch_FlatMap(benchmark::State & state)
+{
+  const auto num_mappings = static_cast<size_type>(state.range(0));
+  const auto values{switch_values(num_mappings)};
+  const auto inputs{switch_inputs(num_mappings)};
+  size_type idx = 0;
+
+  for(auto _ : state)
+  {
+    auto do_find = [](auto p_value, auto) {
+      benchmark::DoNotOptimize(p_value);
+    };
+
+    benchmark::DoNotOptimize(values.find_value(do_find, std::string_view{inputs[idx]}).found);
+    idx = (idx + 1) % inputs.size();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Switch_FlatMap)->RangeMultiplier(2)->Range(2, 2048);
+
+void BM_Switch_Table(benchmark::State & state)
+{
+  const auto num_mappings = static_cast<size_type>(state.range(0));
+  const SwitchTable table{switch_values(num_mappings)};
+  const auto inputs{switch_inputs(num_mappings)};
+  size_type idx = 0;
+
+  for(auto _ : state)
+  {
+    benchmark::DoNotOptimize(table.find(inputs[idx]));
+    idx = (idx + 1) % inputs.size();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  state.counters["strategy"] = static_cast<double>(table.strategy());
+}
+
+BENCHMARK(BM_Switch_Table)->RangeMultiplier(2)->Range(2, 2048);
+
+} // namespace yafiyogi::yy_values::bench
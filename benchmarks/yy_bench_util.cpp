@@ -0,0 +1,118 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string>
+#include <string_view>
+
+#include "fmt/format.h"
+
+#include "yy_bench_util.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+namespace {
+
+constexpr size_type g_num_sites = 16;
+constexpr size_type g_num_sensors = 4;
+
+} // anonymous namespace
+
+std::string device_topic(size_type p_idx)
+{
+  return fmt::format("site/{}/device_{}/sensor_{}",
+                     p_idx % g_num_sites,
+                     p_idx,
+                     p_idx % g_num_sensors);
+}
+
+std::string replace_yaml(size_type p_num_patterns)
+{
+  std::string yaml;
+
+  for(size_type idx = 0; idx < p_num_patterns; ++idx)
+  {
+    fmt::format_to(std::back_inserter(yaml),
+                   "- pattern: \"site/{}/+/#\"\n"
+                   "  format: \"dev-\\\\2-\\\\3\"\n",
+                   idx);
+  }
+
+  return yaml;
+}
+
+std::string values_yaml(size_type p_num_values,
+                        size_type p_num_handlers)
+{
+  std::string yaml;
+
+  for(size_type value_idx = 0; value_idx < p_num_values; ++value_idx)
+  {
+    fmt::format_to(std::back_inserter(yaml),
+                   "- value: \"value_{}\"\n"
+                   "  handlers:\n",
+                   value_idx);
+
+    for(size_type handler_idx = 0; handler_idx < p_num_handlers; ++handler_idx)
+    {
+      fmt::format_to(std::back_inserter(yaml),
+                     "    - handler_id: \"handler_{}\"\n"
+                     "      property: \"property_{}\"\n"
+                     "      location:\n"
+                     "        - pattern: \"site/+/#\"\n"
+                     "          format: \"site-\\\\2\"\n"
+                     "      label_actions:\n"
+                     "        - action: copy\n"
+                     "          source: location\n"
+                     "          target: site\n"
+                     "        - action: keep\n"
+                     "          target: topic\n"
+                     "        - action: replace-path\n"
+                     "          target: device\n"
+                     "          replace:\n"
+                     "            - pattern: \"site/+/+/#\"\n"
+                     "              format: \"\\\\3\"\n"
+                     "        - action: replace-path\n"
+                     "          target: sensor\n"
+                     "          replace:\n"
+                     "            - pattern: \"site/+/+/+\"\n"
+                     "              format: \"\\\\4\"\n"
+                     "        - action: drop\n"
+                     "          target: topic\n"
+                     "      value_actions:\n"
+                     "        - action: switch\n"
+                     "          default: \"unknown\"\n"
+                     "          mappings:\n"
+                     "            \"0\": \"off\"\n"
+                     "            \"1\": \"on\"\n",
+                     handler_idx,
+                     value_idx);
+    }
+  }
+
+  return yaml;
+}
+
+} // namespace yafiyogi::yy_values::bench
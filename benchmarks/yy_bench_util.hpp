@@ -0,0 +1,50 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_mqtt/yy_mqtt_types.h"
+
+#include "yy_values_topic_levels.hpp"
+
+namespace yafiyogi::yy_values::bench {
+
+// Device topic 'site/<site>/<device>/<sensor>' for a given index.
+std::string device_topic(size_type p_idx);
+
+// Replace-path 'replace' sequence with p_num_patterns entries.
+std::string replace_yaml(size_type p_num_patterns);
+
+// 'values' configuration with p_num_values values, each with
+// p_num_handlers handlers using a realistic action chain.
+std::string values_yaml(size_type p_num_values,
+                        size_type p_num_handlers);
+
+} // namespace yafiyogi::yy_values::bench
@@ -0,0 +1,279 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_values_aggregator.hpp"
+#include "yy_values_label_id.hpp"
+#include "yy_values_metric_data.hpp"
+#include "yy_values_metric_id.hpp"
+
+#include "yy_test_alloc_count.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+using namespace std::string_view_literals;
+
+constexpr AggregateFn sum_count = AggregateFn::Sum | AggregateFn::Count;
+
+timestamp_type at(int64_t p_seconds)
+{
+  return timestamp_type{std::chrono::seconds{p_seconds}};
+}
+
+MetricData sample(std::string_view p_device,
+                  double p_value,
+                  int64_t p_seconds)
+{
+  MetricData metric_data{MetricId{"temperature", "room"}};
+
+  metric_data.Labels().set_label(intern_label("device"), p_device);
+  metric_data.Value(fmt::format("{}", p_value));
+  metric_data.Type(ValueType::Float);
+  metric_data.Binary(p_value);
+  metric_data.Status(ValueStatus::Ok);
+  metric_data.Timestamp(at(p_seconds));
+
+  return metric_data;
+}
+
+// The value emitted for p_device's window ending at p_end_seconds by
+// p_fn, if any.
+std::optional<double> emitted(const MetricDataVector & p_out,
+                              std::string_view p_device,
+                              std::string_view p_fn,
+                              int64_t p_end_seconds)
+{
+  for(const auto & metric_data : p_out)
+  {
+    if((at(p_end_seconds) == metric_data.Timestamp())
+       && (p_device == metric_data.Labels().get_label("device"))
+       && (p_fn == metric_data.Labels().get_label(aggregator_detail::aggregate_label)))
+    {
+      return std::get<double>(metric_data.Binary());
+    }
+  }
+
+  return std::nullopt;
+}
+
+} // anonymous namespace
+
+TEST(TestAggregator, WindowCloseEmits)
+{
+  Aggregator aggregator{AggregateConfig{std::chrono::seconds{10}, std::chrono::seconds{0}, AggregateFn::All}};
+  MetricDataVector out{};
+
+  aggregator.Add(sample("dev", 1.0, 1), out);
+  aggregator.Add(sample("dev", 4.0, 2), out);
+  aggregator.Add(sample("dev", 1.5, 9), out);
+  EXPECT_TRUE(out.empty());
+
+  // The first sample past the window closes it.
+  aggregator.Add(sample("dev", 7.0, 12), out);
+  ASSERT_EQ(5, out.size());
+  EXPECT_EQ(3.0, emitted(out, "dev", "count", 10));
+  EXPECT_EQ(6.5, emitted(out, "dev", "sum", 10));
+  EXPECT_EQ(1.0, emitted(out, "dev", "min", 10));
+  EXPECT_EQ(4.0, emitted(out, "dev", "max", 10));
+  EXPECT_EQ(6.5 / 3.0, emitted(out, "dev", "avg", 10));
+
+  const auto & metric_data = out[0];
+  EXPECT_EQ("temperature", metric_data.Id().Name());
+  EXPECT_EQ("room", metric_data.Id().Location());
+  EXPECT_EQ(ValueStatus::Ok, metric_data.Status());
+  out.clear();
+
+  // Advance closes windows when no samples arrive.
+  aggregator.Advance(at(19), out);
+  EXPECT_TRUE(out.empty());
+
+  aggregator.Advance(at(20), out);
+  ASSERT_EQ(5, out.size());
+  EXPECT_EQ(1.0, emitted(out, "dev", "count", 20));
+  EXPECT_EQ(7.0, emitted(out, "dev", "avg", 20));
+  EXPECT_EQ(0, aggregator.Dropped());
+}
+
+TEST(TestAggregator, SlidingPanesRollOver)
+{
+  // Three 10s panes per 30s window, so pane 3 reuses pane 0's slot.
+  Aggregator aggregator{AggregateConfig{std::chrono::seconds{30}, std::chrono::seconds{10}, sum_count}};
+  MetricDataVector out{};
+
+  aggregator.Add(sample("dev", 1.0, 5), out);
+  aggregator.Add(sample("dev", 2.0, 15), out);
+  EXPECT_EQ(1.0, emitted(out, "dev", "sum", 10));
+
+  aggregator.Add(sample("dev", 4.0, 25), out);
+  EXPECT_EQ(3.0, emitted(out, "dev", "sum", 20));
+
+  aggregator.Add(sample("dev", 8.0, 35), out);
+  EXPECT_EQ(7.0, emitted(out, "dev", "sum", 30));
+  EXPECT_EQ(3.0, emitted(out, "dev", "count", 30));
+  out.clear();
+
+  aggregator.Advance(at(40), out);
+  ASSERT_EQ(2, out.size());
+  EXPECT_EQ(14.0, emitted(out, "dev", "sum", 40));
+  EXPECT_EQ(3.0, emitted(out, "dev", "count", 40));
+  out.clear();
+
+  // Only windows still holding data are emitted, however far time
+  // moves, and the series then goes idle.
+  aggregator.Advance(at(1000), out);
+  ASSERT_EQ(4, out.size());
+  EXPECT_EQ(12.0, emitted(out, "dev", "sum", 50));
+  EXPECT_EQ(2.0, emitted(out, "dev", "count", 50));
+  EXPECT_EQ(8.0, emitted(out, "dev", "sum", 60));
+  EXPECT_EQ(1.0, emitted(out, "dev", "count", 60));
+  EXPECT_EQ(0, aggregator.Series());
+}
+
+TEST(TestAggregator, LateSamplesDropped)
+{
+  Aggregator aggregator{AggregateConfig{std::chrono::seconds{30}, std::chrono::seconds{10}, sum_count}};
+  MetricDataVector out{};
+
+  aggregator.Add(sample("dev", 1.0, 5), out);
+  aggregator.Add(sample("dev", 2.0, 35), out);
+  out.clear();
+
+  // Pane 1 is still in the open window [10s, 40s), pane 0 is not.
+  aggregator.Add(sample("dev", 4.0, 15), out);
+  EXPECT_EQ(0, aggregator.Dropped());
+  aggregator.Add(sample("dev", 8.0, 9), out);
+  EXPECT_EQ(1, aggregator.Dropped());
+  EXPECT_TRUE(out.empty());
+
+  // Samples without a parsed value are dropped too.
+  auto unparsed{sample("dev", 16.0, 36)};
+  unparsed.Value("16");
+  aggregator.Add(unparsed, out);
+  EXPECT_EQ(2, aggregator.Dropped());
+
+  aggregator.Advance(at(40), out);
+  EXPECT_EQ(6.0, emitted(out, "dev", "sum", 40));
+  EXPECT_EQ(2.0, emitted(out, "dev", "count", 40));
+}
+
+TEST(TestAggregator, IdleSeriesEvicted)
+{
+  Aggregator aggregator{AggregateConfig{std::chrono::seconds{30}, std::chrono::seconds{10}, sum_count}};
+  MetricDataVector out{};
+
+  aggregator.Add(sample("idle", 1.0, 5), out);
+  aggregator.Add(sample("busy", 2.0, 5), out);
+  EXPECT_EQ(2, aggregator.Series());
+
+  aggregator.Add(sample("busy", 2.0, 15), out);
+  aggregator.Add(sample("busy", 2.0, 25), out);
+  EXPECT_EQ(2, aggregator.Series());
+  EXPECT_EQ(1.0, emitted(out, "idle", "sum", 20));
+  out.clear();
+
+  // Closing the window ending at 30s leaves no open window holding
+  // 'idle's only pane.
+  aggregator.Add(sample("busy", 2.0, 35), out);
+  EXPECT_EQ(1.0, emitted(out, "idle", "sum", 30));
+  EXPECT_EQ(1, aggregator.Series());
+  out.clear();
+
+  aggregator.Advance(at(40), out);
+  EXPECT_FALSE(emitted(out, "idle", "count", 40).has_value());
+  EXPECT_EQ(6.0, emitted(out, "busy", "sum", 40));
+  out.clear();
+
+  // A returning series starts again from its new samples.
+  aggregator.Add(sample("idle", 3.0, 45), out);
+  EXPECT_EQ(2, aggregator.Series());
+  aggregator.Advance(at(50), out);
+  EXPECT_EQ(3.0, emitted(out, "idle", "sum", 50));
+  EXPECT_EQ(1.0, emitted(out, "idle", "count", 50));
+}
+
+TEST(TestAggregator, FreedBlocksReused)
+{
+  constexpr size_type num_series = 4;
+  constexpr int64_t num_windows = 100;
+  constexpr int64_t num_warm_up = 4;
+
+  // No expected series, so nothing is reserved up front.
+  Aggregator aggregator{AggregateConfig{std::chrono::seconds{30}, std::chrono::seconds{10}, sum_count}};
+  MetricDataVector out{};
+
+  // Every window has new series, so each window's series are evicted
+  // by the next and free their pane blocks.
+  yy_quad::simple_vector<MetricData> samples{};
+  samples.reserve(static_cast<size_type>(num_windows) * num_series);
+  for(int64_t window = 0; window < num_windows; ++window)
+  {
+    for(size_type idx = 0; idx < num_series; ++idx)
+    {
+      samples.emplace_back(sample(fmt::format("device_{:04}_{}", window, idx), 1.0, window * 30));
+    }
+  }
+
+  std::size_t allocs_after_warm_up = 0;
+  for(int64_t window = 0; window < num_windows; ++window)
+  {
+    aggregator.Advance(at(window * 30), out);
+    out.clear(yy_data::ClearAction::Keep);
+    EXPECT_EQ(0, aggregator.Series());
+
+    AllocCount allocs{};
+    for(size_type idx = 0; idx < num_series; ++idx)
+    {
+      aggregator.Add(samples[(static_cast<size_type>(window) * num_series) + idx], out);
+    }
+
+    if(window >= num_warm_up)
+    {
+      allocs_after_warm_up += allocs.count();
+    }
+
+    EXPECT_EQ(num_series, aggregator.Series());
+    EXPECT_TRUE(out.empty());
+  }
+
+  EXPECT_EQ(0, allocs_after_warm_up);
+  EXPECT_EQ(0, aggregator.Dropped());
+}
+
+} // namespace yafiyogi::yy_values::tests
@@ -0,0 +1,204 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "yy_test_alloc_count.hpp"
+
+namespace {
+
+std::atomic<bool> g_counting{false};
+std::atomic<std::size_t> g_allocs{0};
+
+void count_alloc() noexcept
+{
+  if(g_counting.load(std::memory_order_relaxed))
+  {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void * alloc(std::size_t p_size) noexcept
+{
+  count_alloc();
+
+  return std::malloc(p_size ? p_size : 1);
+}
+
+void * alloc(std::size_t p_size,
+             std::align_val_t p_align) noexcept
+{
+  count_alloc();
+
+  const auto align = static_cast<std::size_t>(p_align);
+  const auto size = ((p_size ? p_size : 1) + align - 1) & ~(align - 1);
+
+  return std::aligned_alloc(align, size);
+}
+
+template<typename... Args>
+void * alloc_or_throw(Args... args)
+{
+  if(void * ptr = alloc(args...))
+  {
+    return ptr;
+  }
+
+  throw std::bad_alloc{};
+}
+
+} // anonymous namespace
+
+namespace yafiyogi::yy_values::tests {
+
+AllocCount::AllocCount() noexcept
+{
+  g_allocs = 0;
+  g_counting = true;
+}
+
+AllocCount::~AllocCount() noexcept
+{
+  g_counting = false;
+}
+
+std::size_t AllocCount::count() const noexcept
+{
+  return g_allocs.load();
+}
+
+} // namespace yafiyogi::yy_values::tests
+
+void * operator new(std::size_t p_size)
+{
+  return alloc_or_throw(p_size);
+}
+
+void * operator new[](std::size_t p_size)
+{
+  return alloc_or_throw(p_size);
+}
+
+void * operator new(std::size_t p_size,
+                    const std::nothrow_t &) noexcept
+{
+  return alloc(p_size);
+}
+
+void * operator new[](std::size_t p_size,
+                      const std::nothrow_t &) noexcept
+{
+  return alloc(p_size);
+}
+
+void * operator new(std::size_t p_size,
+                    std::align_val_t p_align)
+{
+  return alloc_or_throw(p_size, p_align);
+}
+
+void * operator new[](std::size_t p_size,
+                      std::align_val_t p_align)
+{
+  return alloc_or_throw(p_size, p_align);
+}
+
+void * operator new(std::size_t p_size,
+                    std::align_val_t p_align,
+                    const std::nothrow_t &) noexcept
+{
+  return alloc(p_size, p_align);
+}
+
+void * operator new[](std::size_t p_size,
+                      std::align_val_t p_align,
+                      const std::nothrow_t &) noexcept
+{
+  return alloc(p_size, p_align);
+}
+
+void operator delete(void * p_ptr) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete[](void * p_ptr) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete(void * p_ptr, std::size_t) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete[](void * p_ptr, std::size_t) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete(void * p_ptr, std::align_val_t) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete[](void * p_ptr, std::align_val_t) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete(void * p_ptr, std::size_t, std::align_val_t) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete[](void * p_ptr, std::size_t, std::align_val_t) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete(void * p_ptr, const std::nothrow_t &) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete[](void * p_ptr, const std::nothrow_t &) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete(void * p_ptr, std::align_val_t, const std::nothrow_t &) noexcept
+{
+  std::free(p_ptr);
+}
+
+void operator delete[](void * p_ptr, std::align_val_t, const std::nothrow_t &) noexcept
+{
+  std::free(p_ptr);
+}
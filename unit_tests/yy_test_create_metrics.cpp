@@ -0,0 +1,238 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+#include "spdlog/sinks/ostream_sink.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_values_metric_spec.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+constexpr size_type g_num_handlers = 4;
+constexpr size_type g_num_values = 20;
+constexpr size_type g_max_threads = 4;
+
+// Every value has a handler each, cycling through the action kinds,
+// so there are enough specs to build on g_max_threads threads.
+std::string values_yaml()
+{
+  std::string yaml{};
+
+  for(size_type value_idx = 0; value_idx < g_num_values; ++value_idx)
+  {
+    fmt::format_to(std::back_inserter(yaml),
+                   "- value: \"value_{}\"\n"
+                   "  handlers:\n",
+                   value_idx);
+
+    for(size_type handler_idx = 0; handler_idx < g_num_handlers; ++handler_idx)
+    {
+      fmt::format_to(std::back_inserter(yaml),
+                     "    - handler_id: \"handler_{}\"\n"
+                     "      property: \"prop_{}\"\n"
+                     "      label_actions:\n"
+                     "        - action: replace-path\n"
+                     "          target: device_{}\n"
+                     "          replace:\n"
+                     "            - pattern: \"site/+/+/#\"\n"
+                     "              format: \"\\\\3\"\n",
+                     handler_idx,
+                     value_idx,
+                     handler_idx);
+
+      switch((value_idx + handler_idx) % 3)
+      {
+        case 0:
+          fmt::format_to(std::back_inserter(yaml),
+                         "      value_actions:\n"
+                         "        - action: switch\n"
+                         "          default: \"unknown\"\n"
+                         "          mappings:\n"
+                         "            \"0\": \"off\"\n"
+                         "            \"1\": \"on_{}\"\n",
+                         value_idx);
+          break;
+
+        case 1:
+          fmt::format_to(std::back_inserter(yaml),
+                         "      value_actions:\n"
+                         "        - action: scale\n"
+                         "          factor: {}\n"
+                         "        - action: range\n"
+                         "          default: \"unknown\"\n"
+                         "          ranges:\n"
+                         "            - below: 10\n"
+                         "              value: \"low\"\n"
+                         "            - value: \"high\"\n",
+                         value_idx + 1);
+          break;
+
+        default:
+          yaml.append("      dedup: suppress\n");
+          break;
+      }
+    }
+  }
+
+  return yaml;
+}
+
+// Builds p_specs, returning the log output of the build.
+MetricsMap create_logged(const MetricSpecs & p_specs,
+                         size_type p_max_threads,
+                         std::string & p_log)
+{
+  std::ostringstream log{};
+  auto sink{std::make_shared<spdlog::sinks::ostream_sink_mt>(log)};
+  auto logger{std::make_shared<spdlog::logger>("create_metrics", sink)};
+  logger->set_pattern("%l %v");
+  logger->set_level(spdlog::level::trace);
+
+  auto previous{spdlog::default_logger()};
+  spdlog::set_default_logger(logger);
+  spdlog::set_level(spdlog::level::info);
+
+  auto metrics{create_metrics(p_specs, nullptr, p_max_threads)};
+
+  spdlog::set_default_logger(previous);
+  spdlog::set_level(spdlog::level::warn);
+
+  p_log = log.str();
+
+  return metrics;
+}
+
+} // anonymous namespace
+
+TEST(TestCreateMetrics, SameResultForAnyThreadCount)
+{
+  spdlog::set_level(spdlog::level::warn);
+
+  const auto specs{configure_metric_specs(YAML::Load(values_yaml()))};
+  ASSERT_EQ(g_num_handlers * g_num_values, specs.size());
+  ASSERT_LE(g_max_threads * metric_spec_detail::min_specs_per_thread, specs.size());
+
+  std::string serial_log{};
+  auto serial{create_logged(specs, 1, serial_log)};
+  EXPECT_FALSE(serial_log.empty());
+
+  // Repeat, as a scheduling dependent order would not show every time.
+  for(size_type round = 0; round < 4; ++round)
+  {
+    SCOPED_TRACE(round);
+
+    std::string parallel_log{};
+    auto parallel{create_logged(specs, g_max_threads, parallel_log)};
+
+    EXPECT_EQ(serial_log, parallel_log);
+    ASSERT_EQ(serial.size(), parallel.size());
+
+    for(size_type idx = 0; idx < serial.size(); ++idx)
+    {
+      auto [serial_handler, serial_metrics] = serial[idx];
+      auto [parallel_handler, parallel_metrics] = parallel[idx];
+
+      EXPECT_EQ(serial_handler, parallel_handler);
+      ASSERT_EQ(serial_metrics.size(), parallel_metrics.size());
+
+      for(size_type metric_idx = 0; metric_idx < serial_metrics.size(); ++metric_idx)
+      {
+        const auto & serial_metric = *serial_metrics[metric_idx];
+        const auto & parallel_metric = *parallel_metrics[metric_idx];
+
+        EXPECT_EQ(serial_metric.Id().Name(), parallel_metric.Id().Name());
+        EXPECT_EQ(serial_metric.Property(), parallel_metric.Property());
+        ASSERT_NE(nullptr, serial_metric.Spec());
+        ASSERT_NE(nullptr, parallel_metric.Spec());
+        EXPECT_TRUE(*serial_metric.Spec() == *parallel_metric.Spec());
+      }
+    }
+  }
+}
+
+TEST(TestCreateMetrics, WorkerExceptionRethrown)
+{
+  constexpr size_type num_items = 64;
+  const auto caller{std::this_thread::get_id()};
+
+  std::array<std::atomic<size_type>, num_items> built{};
+  std::atomic<size_type> num_thrown{0};
+
+  // Slow enough that every worker claims items, and each throws on
+  // all of them.
+  auto build = [&](size_type p_idx) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    built[p_idx].fetch_add(1);
+
+    if(caller != std::this_thread::get_id())
+    {
+      num_thrown.fetch_add(1);
+      throw std::runtime_error{fmt::format("item {}", p_idx)};
+    }
+  };
+
+  EXPECT_THROW(metric_spec_detail::parallel_build(num_items, g_max_threads, build),
+               std::runtime_error);
+  EXPECT_LT(0, num_thrown.load());
+
+  // A throwing worker carries on, so every item is still built once.
+  for(size_type idx = 0; idx < num_items; ++idx)
+  {
+    EXPECT_EQ(1, built[idx].load()) << idx;
+  }
+}
+
+TEST(TestCreateMetrics, SerialExceptionRethrown)
+{
+  auto build = [](size_type p_idx) {
+    if(3 == p_idx)
+    {
+      throw std::runtime_error{"item 3"};
+    }
+  };
+
+  EXPECT_THROW(metric_spec_detail::parallel_build(8, 1, build),
+               std::runtime_error);
+}
+
+} // namespace yafiyogi::yy_values::tests
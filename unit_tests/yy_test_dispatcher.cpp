@@ -0,0 +1,179 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_values_dispatcher.hpp"
+#include "yy_values_topic_levels.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+constexpr size_type g_num_handlers = 8;
+constexpr size_type g_num_events = 256;
+constexpr size_type g_num_shards = 4;
+
+std::string values_yaml()
+{
+  std::string yaml{"- value: \"temperature\"\n"
+                   "  handlers:\n"};
+
+  for(size_type idx = 0; idx < g_num_handlers; ++idx)
+  {
+    fmt::format_to(std::back_inserter(yaml),
+                   "    - handler_id: \"handler_{}\"\n"
+                   "      property: \"temp\"\n"
+                   "      value_actions:\n"
+                   "        - action: switch\n"
+                   "          default: \"unknown\"\n"
+                   "          mappings:\n"
+                   "            \"0\": \"off\"\n"
+                   "            \"1\": \"on\"\n",
+                   idx);
+  }
+
+  return yaml;
+}
+
+} // anonymous namespace
+
+class TestDispatcher:
+      public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+      spdlog::set_level(spdlog::level::warn);
+
+      metrics = configure_values(YAML::Load(values_yaml()));
+      ASSERT_EQ(g_num_handlers, metrics.size());
+
+      handlers.reserve(g_num_events);
+      topics.reserve(g_num_events);
+      levels.resize(g_num_events);
+      for(size_type idx = 0; idx < g_num_events; ++idx)
+      {
+        handlers.emplace_back(fmt::format("handler_{}", idx % g_num_handlers));
+        topics.emplace_back(fmt::format("site/{}/sensor", idx));
+        topic_levels(topics[idx], levels[idx]);
+      }
+    }
+
+    // Returns the number of "on" values.
+    size_type Run(MetricsDispatcher & p_dispatcher,
+                  MetricDataVector & p_metric_data)
+    {
+      for(size_type idx = 0; idx < g_num_events; ++idx)
+      {
+        EXPECT_TRUE(p_dispatcher.Add(handlers[idx],
+                                     MetricEvent{(idx & 1) ? "1" : "0",
+                                                 topics[idx],
+                                                 yy_data::observer_ptr<const yy_mqtt::TopicLevelsView>{&levels[idx]},
+                                                 timestamp_type{},
+                                                 ValueType::String}));
+      }
+
+      p_dispatcher.Dispatch(MetricDataVectorPtr{&p_metric_data});
+
+      size_type num_on = 0;
+      for(const auto & metric_data : p_metric_data)
+      {
+        num_on += ("on" == metric_data.Value()) ? 1 : 0;
+      }
+
+      return num_on;
+    }
+
+    MetricsMap metrics{};
+    yy_quad::simple_vector<std::string> handlers{};
+    yy_quad::simple_vector<std::string> topics{};
+    yy_quad::simple_vector<yy_mqtt::TopicLevelsView> levels{};
+};
+
+TEST_F(TestDispatcher, DispatchEveryEvent)
+{
+  MetricsDispatcher dispatcher{std::move(metrics), g_num_shards};
+  MetricDataVector metric_data{};
+
+  EXPECT_FALSE(dispatcher.Add("missing", MetricEvent{}));
+
+  for(int pass = 0; pass < 2; ++pass)
+  {
+    EXPECT_EQ(g_num_events / 2, Run(dispatcher, metric_data));
+    EXPECT_EQ(g_num_events, metric_data.size());
+    metric_data.clear(yy_data::ClearAction::Keep);
+  }
+}
+
+TEST_F(TestDispatcher, DispatchersShareMetrics)
+{
+  // Both dispatchers hold the same Metrics; each must use its own
+  // contexts, so running them concurrently is race free.
+  MetricsDispatcher dispatcher_a{MetricsMap{metrics}, g_num_shards};
+  MetricsDispatcher dispatcher_b{MetricsMap{metrics}, g_num_shards};
+
+  auto do_run = [this](MetricsDispatcher & p_dispatcher,
+                       size_type & p_num_on,
+                       size_type & p_num_out) {
+    MetricDataVector metric_data{};
+
+    for(int pass = 0; pass < 8; ++pass)
+    {
+      p_num_on += Run(p_dispatcher, metric_data);
+      p_num_out += metric_data.size();
+      metric_data.clear(yy_data::ClearAction::Keep);
+    }
+  };
+
+  size_type num_on_a = 0;
+  size_type num_out_a = 0;
+  size_type num_on_b = 0;
+  size_type num_out_b = 0;
+  {
+    std::jthread thread_a{do_run, std::ref(dispatcher_a), std::ref(num_on_a), std::ref(num_out_a)};
+    std::jthread thread_b{do_run, std::ref(dispatcher_b), std::ref(num_on_b), std::ref(num_out_b)};
+  }
+
+  EXPECT_EQ(8 * g_num_events / 2, num_on_a);
+  EXPECT_EQ(8 * g_num_events, num_out_a);
+  EXPECT_EQ(8 * g_num_events / 2, num_on_b);
+  EXPECT_EQ(8 * g_num_events, num_out_b);
+}
+
+} // namespace yafiyogi::yy_values::tests
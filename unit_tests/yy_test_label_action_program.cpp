@@ -0,0 +1,179 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <string>
+#include <string_view>
+
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_label_action.hpp"
+#include "yy_label_action_program.hpp"
+#include "yy_values_labels.hpp"
+#include "yy_values_metric_labels.hpp"
+#include "yy_values_topic_levels.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+constexpr std::string_view g_label_actions_yaml =
+  "- action: copy\n"
+  "  source: location\n"
+  "  target: site\n"
+  "- action: copy\n"
+  "  source: missing\n"
+  "  target: other\n"
+  "- action: keep\n"
+  "  target: topic\n"
+  "- action: keep\n"
+  "  target: missing\n"
+  "- action: replace-path\n"
+  "  target: device\n"
+  "  replace:\n"
+  "    - pattern: \"site/+/+/#\"\n"
+  "      format: \"\\\\3\"\n"
+  "    - pattern: \"other/#\"\n"
+  "      format: \"other-\\\\2\"\n"
+  "- action: copy\n"
+  "  source: site\n"
+  "  target: site_copy\n"
+  "- action: drop\n"
+  "  target: topic\n"
+  "- action: drop\n"
+  "  target: missing\n";
+
+constexpr std::string_view g_topics[] = {
+  "site/1/device_1/sensor",
+  "site/2/device_22/sensor/extra",
+  "site/3",
+  "other/device_3",
+  "unmatched/topic"
+};
+
+} // anonymous namespace
+
+class TestLabelActionProgram:
+      public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+      spdlog::set_level(spdlog::level::warn);
+
+      actions = configure_label_actions(YAML::Load(std::string{g_label_actions_yaml}));
+      program = compile_label_actions(actions);
+    }
+
+    void ApplyActions(const Labels & p_labels_in,
+                      const yy_mqtt::TopicLevelsView & p_levels,
+                      Labels & p_labels_out) const
+    {
+      for(const auto & action : actions)
+      {
+        action->Apply(p_labels_in, p_levels, p_labels_out);
+      }
+    }
+
+    LabelActions actions{};
+    LabelActionProgram program{};
+};
+
+TEST_F(TestLabelActionProgram, CompileOneInstructionPerAction)
+{
+  EXPECT_EQ(actions.size(), program.size());
+}
+
+TEST_F(TestLabelActionProgram, ApplyMatchesActions)
+{
+  auto caches{program.create_caches()};
+  auto stats{program.create_stats()};
+  yy_mqtt::TopicLevelsView levels{};
+
+  // Twice, so the second pass runs on cached replace-path matches.
+  for(int pass = 0; pass < 2; ++pass)
+  {
+    for(auto topic : g_topics)
+    {
+      for(auto with_location : {false, true})
+      {
+        topic_levels(topic, levels);
+
+        Labels labels_in{};
+        labels_in.set_label(g_label_topic_id, topic);
+        if(with_location)
+        {
+          labels_in.set_label(g_label_location_id, "a_location");
+        }
+
+        Labels expected{labels_in};
+        ApplyActions(labels_in, levels, expected);
+
+        Labels labels_out{labels_in};
+        program.Apply(labels_in, levels, labels_out, caches, stats);
+
+        EXPECT_EQ(expected, labels_out) << "topic [" << topic << "] location " << with_location;
+        EXPECT_EQ(expected.get_label("site"), labels_out.get_label("site"));
+        EXPECT_EQ(expected.get_label("device"), labels_out.get_label("device"));
+      }
+    }
+  }
+}
+
+TEST_F(TestLabelActionProgram, ApplyToReusedLabels)
+{
+  auto caches{program.create_caches()};
+  auto stats{program.create_stats()};
+  yy_mqtt::TopicLevelsView levels{};
+  Labels expected{};
+  Labels labels_out{};
+
+  // Output Labels are cleared and reused between events, as in Metric::Event.
+  for(auto topic : g_topics)
+  {
+    topic_levels(topic, levels);
+
+    Labels labels_in{};
+    labels_in.set_label(g_label_topic_id, topic);
+    labels_in.set_label(g_label_location_id, topic);
+
+    expected.clear(yy_data::ClearAction::Keep);
+    expected.set_label(g_label_topic_id, topic);
+    ApplyActions(labels_in, levels, expected);
+
+    labels_out.clear(yy_data::ClearAction::Keep);
+    labels_out.set_label(g_label_topic_id, topic);
+    program.Apply(labels_in, levels, labels_out, caches, stats);
+
+    EXPECT_EQ(expected, labels_out) << "topic [" << topic << "]";
+    EXPECT_EQ(expected.size(), labels_out.size());
+  }
+}
+
+} // namespace yafiyogi::yy_values::tests
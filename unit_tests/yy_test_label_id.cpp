@@ -0,0 +1,108 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+
+#include "yy_values_label_id.hpp"
+#include "yy_values_metric_labels.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+TEST(TestLabelId, IdOnly)
+{
+  EXPECT_EQ(sizeof(LabelId::id_type), sizeof(LabelId));
+}
+
+TEST(TestLabelId, BuiltInLabels)
+{
+  EXPECT_EQ(g_label_location, g_label_location_id.Name());
+  EXPECT_EQ(g_label_topic, g_label_topic_id.Name());
+  EXPECT_EQ(g_label_location_id, find_label(g_label_location));
+  EXPECT_EQ(g_label_topic_id, intern_label(g_label_topic));
+}
+
+TEST(TestLabelId, InternAndFind)
+{
+  EXPECT_TRUE(find_label("test_label_id_unknown").empty());
+  EXPECT_EQ("", LabelId{}.Name());
+
+  const auto l_id = intern_label("test_label_id_a");
+  EXPECT_FALSE(l_id.empty());
+  EXPECT_EQ("test_label_id_a", l_id.Name());
+  EXPECT_EQ(l_id, find_label("test_label_id_a"));
+  EXPECT_EQ(l_id, intern_label("test_label_id_a"));
+}
+
+TEST(TestLabelId, InternBatchInOrder)
+{
+  const std::string_view l_labels[] = {"test_label_id_b",
+                                       "test_label_id_c",
+                                       "test_label_id_b",
+                                       "test_label_id_d"};
+
+  intern_labels(l_labels);
+
+  const auto l_b = find_label("test_label_id_b");
+  const auto l_c = find_label("test_label_id_c");
+  const auto l_d = find_label("test_label_id_d");
+
+  ASSERT_FALSE(l_b.empty());
+  EXPECT_EQ(l_b.Id() + 1, l_c.Id());
+  EXPECT_EQ(l_c.Id() + 1, l_d.Id());
+  EXPECT_EQ("test_label_id_d", l_d.Name());
+}
+
+TEST(TestLabelId, ReadWhileInterning)
+{
+  constexpr int num_labels = 200;
+  const auto l_known = intern_label("test_label_id_known");
+  std::atomic<bool> l_done{false};
+
+  std::jthread l_reader{[&l_done, l_known]() {
+    while(!l_done.load(std::memory_order_relaxed))
+    {
+      EXPECT_EQ(l_known, find_label("test_label_id_known"));
+      EXPECT_EQ("test_label_id_known", l_known.Name());
+    }
+  }};
+
+  for(int idx = 0; idx < num_labels; ++idx)
+  {
+    const auto l_label{fmt::format("test_label_id_concurrent_{}", idx)};
+    EXPECT_EQ(l_label, intern_label(l_label).Name());
+  }
+
+  l_done.store(true, std::memory_order_relaxed);
+}
+
+} // namespace yafiyogi::yy_values::tests
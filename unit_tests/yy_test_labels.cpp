@@ -0,0 +1,244 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "gtest/gtest.h"
+
+#include "yy_values_labels.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+using Reference = std::map<std::string, std::string>;
+
+void expect_equal(const Reference & p_reference,
+                  const Labels & p_labels)
+{
+  ASSERT_EQ(p_reference.size(), p_labels.size());
+
+  for(const auto & [label, value] : p_reference)
+  {
+    EXPECT_EQ(value, p_labels.get_label(label)) << "label [" << label << "]";
+  }
+
+  // A set built from scratch has the same hash and compares equal.
+  Labels rebuilt{};
+  for(const auto & [label, value] : p_reference)
+  {
+    rebuilt.set_label(intern_label(label), value);
+  }
+
+  EXPECT_EQ(rebuilt.Hash(), p_labels.Hash());
+  EXPECT_EQ(rebuilt, p_labels);
+}
+
+} // anonymous namespace
+
+class TestLabels:
+      public testing::Test
+{
+  public:
+    static void SetUpTestSuite()
+    {
+      constexpr std::array<std::string_view, 4> labels{"a", "b", "c", "source"};
+      intern_labels(labels);
+
+      for(int idx = 0; idx < 12; ++idx)
+      {
+        std::ignore = intern_label("label_" + std::to_string(idx));
+      }
+    }
+};
+
+TEST_F(TestLabels, SetGetErase)
+{
+  Labels labels{};
+
+  labels.set_label(intern_label("b"), "value_b");
+  labels.set_label(intern_label("a"), "value_a");
+  labels.set_label(intern_label("c"), "");
+
+  EXPECT_EQ(3, labels.size());
+  EXPECT_EQ("value_a", labels.get_label("a"));
+  EXPECT_EQ("value_b", labels.get_label("b"));
+  EXPECT_EQ("", labels.get_label("c"));
+  EXPECT_EQ("", labels.get_label("missing"));
+
+  labels.set_label(intern_label("a"), "a_longer_value_than_before");
+  labels.set_label(intern_label("b"), "b");
+  EXPECT_EQ("a_longer_value_than_before", labels.get_label("a"));
+  EXPECT_EQ("b", labels.get_label("b"));
+
+  labels.erase("a");
+  EXPECT_EQ(2, labels.size());
+  EXPECT_EQ("", labels.get_label("a"));
+  EXPECT_EQ("b", labels.get_label("b"));
+}
+
+TEST_F(TestLabels, GetUnknownNameEmpty)
+{
+  Labels labels{};
+
+  labels.set_label(intern_label("a"), "value_a");
+
+  EXPECT_EQ("", labels.get_label("never_interned"));
+  EXPECT_TRUE(find_label("never_interned").empty());
+}
+
+TEST_F(TestLabels, SetFromOwnValue)
+{
+  Labels labels{};
+
+  labels.set_label(intern_label("source"), "a_value_long_enough_to_need_a_heap_buffer");
+
+  // Copying a value within the set, as a copy action on the
+  // properties does, must survive the buffer growing.
+  for(int idx = 0; idx < 16; ++idx)
+  {
+    labels.set_label(intern_label("target_" + std::to_string(idx)),
+                     labels.get_label("source"));
+  }
+
+  for(int idx = 0; idx < 16; ++idx)
+  {
+    EXPECT_EQ(labels.get_label("source"), labels.get_label("target_" + std::to_string(idx)));
+  }
+
+  labels.set_label(intern_label("source"), labels.get_label("source").substr(2));
+  EXPECT_EQ("value_long_enough_to_need_a_heap_buffer", labels.get_label("source"));
+}
+
+TEST_F(TestLabels, AssignLabelAppends)
+{
+  Labels labels{};
+
+  labels.set_label(intern_label("a"), "first");
+  labels.assign_label(intern_label("a"), [](std::string & p_value) {
+    p_value.append("second");
+  });
+  labels.assign_label(intern_label("b"), [](std::string & p_value) {
+    p_value.append("third");
+  });
+
+  EXPECT_EQ("second", labels.get_label("a"));
+  EXPECT_EQ("third", labels.get_label("b"));
+}
+
+TEST_F(TestLabels, SwapAndMove)
+{
+  Labels lhs{};
+  Labels rhs{};
+
+  lhs.set_label(intern_label("a"), "lhs_value_long_enough_to_need_a_heap_buffer");
+  rhs.set_label(intern_label("b"), "rhs");
+
+  swap(lhs, rhs);
+  EXPECT_EQ("rhs", lhs.get_label("b"));
+  EXPECT_EQ("lhs_value_long_enough_to_need_a_heap_buffer", rhs.get_label("a"));
+
+  Labels moved{std::move(rhs)};
+  EXPECT_EQ(0, rhs.size());
+  EXPECT_EQ("lhs_value_long_enough_to_need_a_heap_buffer", moved.get_label("a"));
+
+  Labels copied{moved};
+  EXPECT_EQ(moved, copied);
+}
+
+TEST_F(TestLabels, MatchesReference)
+{
+  std::mt19937 gen{1234};
+  Labels labels{};
+  Reference reference{};
+
+  auto random_value = [&gen]() {
+    return std::string(gen() % 40, static_cast<char>('a' + (gen() % 26)));
+  };
+
+  for(int step = 0; step < 20000; ++step)
+  {
+    const std::string label{"label_" + std::to_string(gen() % 12)};
+
+    switch(gen() % 16)
+    {
+      case 0:
+        labels.clear(yy_data::ClearAction::Keep);
+        reference.clear();
+        break;
+
+      case 1:
+      case 2:
+        labels.erase(label);
+        reference.erase(label);
+        break;
+
+      case 3:
+        if(auto source{"label_" + std::to_string(gen() % 12)};
+           reference.contains(source))
+        {
+          labels.set_label(intern_label(label), labels.get_label(source));
+          reference[label] = reference[source];
+        }
+        break;
+
+      case 4:
+      {
+        const auto value{random_value()};
+
+        labels.assign_label(intern_label(label), [&value](std::string & p_value) {
+          p_value.append(value);
+        });
+        reference[label] = value;
+      }
+      break;
+
+      default:
+      {
+        const auto value{random_value()};
+
+        labels.set_label(intern_label(label), value);
+        reference[label] = value;
+      }
+      break;
+    }
+
+    expect_equal(reference, labels);
+    if(HasFailure())
+    {
+      FAIL() << "step " << step;
+    }
+  }
+}
+
+} // namespace yafiyogi::yy_values::tests
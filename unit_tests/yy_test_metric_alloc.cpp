@@ -0,0 +1,288 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <span>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_values_metric.hpp"
+#include "yy_values_metric_data_pool.hpp"
+#include "yy_values_metric_id.hpp"
+#include "yy_values_topic_levels.hpp"
+
+#include "yy_test_alloc_count.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+constexpr std::string_view g_values_yaml =
+  "- value: \"temperature\"\n"
+  "  handlers:\n"
+  "    - handler_id: \"handler\"\n"
+  "      property: \"temp\"\n"
+  "      location:\n"
+  "        - pattern: \"site/+/#\"\n"
+  "          format: \"site-\\\\2\"\n"
+  "      label_actions:\n"
+  "        - action: copy\n"
+  "          source: location\n"
+  "          target: site\n"
+  "        - action: keep\n"
+  "          target: topic\n"
+  "        - action: replace-path\n"
+  "          target: device\n"
+  "          replace:\n"
+  "            - pattern: \"site/+/+/#\"\n"
+  "              format: \"\\\\3\"\n"
+  "        - action: drop\n"
+  "          target: topic\n"
+  "      value_actions:\n"
+  "        - action: switch\n"
+  "          default: \"unknown\"\n"
+  "          mappings:\n"
+  "            \"0\": \"off\"\n"
+  "            \"1\": \"on\"\n";
+
+constexpr size_type g_num_topics = 16;
+
+} // anonymous namespace
+
+class TestMetricAlloc:
+      public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+      spdlog::set_level(spdlog::level::warn);
+
+      auto metrics{configure_values(YAML::Load(std::string{g_values_yaml}))};
+      ASSERT_EQ(1, metrics.size());
+
+      auto [ignore_key, handler_metrics] = metrics[0];
+      ASSERT_EQ(1, handler_metrics.size());
+      metric = handler_metrics[0];
+
+      topics.reserve(g_num_topics);
+      levels.resize(g_num_topics);
+      for(size_type idx = 0; idx < g_num_topics; ++idx)
+      {
+        topics.emplace_back(fmt::format("site/{}/device_{}/sensor", idx % 4, idx));
+        topic_levels(topics[idx], levels[idx]);
+      }
+    }
+
+    void Run(const Metric & p_metric,
+             MetricContext & p_context,
+             MetricDataVector & p_metric_data,
+             size_type p_rounds)
+    {
+      for(size_type round = 0; round < p_rounds; ++round)
+      {
+        for(size_type idx = 0; idx < g_num_topics; ++idx)
+        {
+          p_metric.Event(p_context,
+                         (idx & 1) ? "1" : "0",
+                         topics[idx],
+                         levels[idx],
+                         timestamp_type{},
+                         ValueType::String,
+                         MetricDataVectorPtr{&p_metric_data});
+        }
+
+        // Keep the output slots, as a consumer draining the vector would.
+        p_metric_data.clear(yy_data::ClearAction::Keep);
+      }
+    }
+
+    MetricPtr metric{};
+    yy_quad::simple_vector<std::string> topics{};
+    yy_quad::simple_vector<yy_mqtt::TopicLevelsView> levels{};
+};
+
+TEST_F(TestMetricAlloc, EventSteadyStateDoesNotAllocate)
+{
+  const auto & l_metric = *metric;
+  auto context{l_metric.CreateContext()};
+  MetricDataVector metric_data{};
+
+  // Warm up until every pooled MetricData has held every topic, so
+  // all label buffers have reached their final capacity.
+  Run(l_metric, context, metric_data, g_num_topics + 1);
+
+  AllocCount allocs{};
+  Run(l_metric, context, metric_data, 100);
+
+  EXPECT_EQ(0, allocs.count());
+}
+
+TEST_F(TestMetricAlloc, PoolRecycleDoesNotAllocate)
+{
+  const auto & l_metric = *metric;
+  auto context{l_metric.CreateContext()};
+  MetricDataPool pool{};
+
+  // One collection cycle: fill an acquired vector, then hand it back.
+  auto cycle = [this, &l_metric, &context, &pool]() {
+    auto metric_data{pool.Acquire()};
+    const auto l_capacity = metric_data.capacity();
+
+    for(size_type idx = 0; idx < g_num_topics; ++idx)
+    {
+      l_metric.Event(context,
+                     (idx & 1) ? "1" : "0",
+                     topics[idx],
+                     levels[idx],
+                     timestamp_type{},
+                     ValueType::String,
+                     MetricDataVectorPtr{&metric_data});
+    }
+
+    EXPECT_EQ(g_num_topics, metric_data.size());
+    pool.Recycle(std::move(metric_data));
+
+    return l_capacity;
+  };
+
+  // Warm up the pool slot and every pooled MetricData.
+  for(size_type round = 0; round <= g_num_topics; ++round)
+  {
+    std::ignore = cycle();
+  }
+  EXPECT_EQ(1, pool.Available());
+  EXPECT_EQ(g_num_topics, pool.Capacity());
+
+  AllocCount allocs{};
+  for(size_type round = 0; round < 10; ++round)
+  {
+    // A recycled vector comes back with its capacity.
+    EXPECT_LE(g_num_topics, cycle());
+  }
+
+  EXPECT_EQ(0, allocs.count());
+  EXPECT_EQ(1, pool.Available());
+}
+
+TEST_F(TestMetricAlloc, EventSteadyStateOutput)
+{
+  const auto & l_metric = *metric;
+  auto context{l_metric.CreateContext()};
+  MetricDataVector metric_data{};
+
+  Run(l_metric, context, metric_data, 2);
+
+  l_metric.Event(context,
+                 "1",
+                 topics[1],
+                 levels[1],
+                 timestamp_type{},
+                 ValueType::String,
+                 MetricDataVectorPtr{&metric_data});
+
+  // topics[1] is "site/1/device_1/sensor".
+  ASSERT_EQ(1, metric_data.size());
+  const auto & l_metric_data = metric_data[0];
+  EXPECT_EQ("on", l_metric_data.Value());
+  EXPECT_EQ(l_metric.Id().Name(), l_metric_data.Id().Name());
+  EXPECT_EQ("site-1", l_metric_data.Id().Location());
+
+  // Reused output slots must not keep labels from earlier events.
+  const auto & l_labels = l_metric_data.Labels();
+  EXPECT_EQ(3, l_labels.size());
+  EXPECT_EQ("site-1", l_labels.get_label("location"));
+  EXPECT_EQ("site-1", l_labels.get_label("site"));
+  EXPECT_EQ("device_1", l_labels.get_label("device"));
+  EXPECT_EQ("", l_labels.get_label("topic"));
+}
+
+TEST_F(TestMetricAlloc, EventWithoutLevels)
+{
+  const auto & l_metric = *metric;
+  auto context{l_metric.CreateContext()};
+  MetricDataVector metric_data{};
+
+  // Replace-path formats find no levels, but the event is processed.
+  EXPECT_TRUE(l_metric.Event(context,
+                             MetricEvent{"1", topics[1]},
+                             MetricDataVectorPtr{&metric_data}));
+
+  ASSERT_EQ(1, metric_data.size());
+  EXPECT_EQ("on", metric_data[0].Value());
+  EXPECT_EQ("", metric_data[0].Labels().get_label("device"));
+}
+
+TEST_F(TestMetricAlloc, EventsReserveGeometrically)
+{
+  const auto & l_metric = *metric;
+  auto context{l_metric.CreateContext()};
+  MetricDataVector metric_data{};
+
+  const MetricEvent l_event{"1",
+                            topics[1],
+                            yy_data::observer_ptr<const yy_mqtt::TopicLevelsView>{&levels[1]}};
+  constexpr size_type num_batches = 1024;
+  size_type num_grows = 0;
+
+  for(size_type idx = 0; idx < num_batches; ++idx)
+  {
+    const auto l_capacity = metric_data.capacity();
+
+    l_metric.Events(context, std::span{&l_event, 1}, MetricDataVectorPtr{&metric_data});
+    num_grows += (l_capacity != metric_data.capacity()) ? 1 : 0;
+  }
+
+  EXPECT_EQ(num_batches, metric_data.size());
+  EXPECT_GE(11, num_grows);
+}
+
+TEST(TestMetricId, LocationKeepsHash)
+{
+  MetricId id{"metric", "site-1"};
+  const auto hash = id.Hash();
+
+  // Each event sets the location, usually to the one already there.
+  id.Location(std::string_view{"site-1"});
+  EXPECT_EQ(hash, id.Hash());
+  id.Location(std::string{"site-1"});
+  EXPECT_EQ(hash, id.Hash());
+
+  id.Location(std::string_view{"site-2"});
+  EXPECT_EQ(MetricId("metric", "site-2").Hash(), id.Hash());
+  EXPECT_EQ("site-2", id.Location());
+
+  id.Location(std::string{"site-1"});
+  EXPECT_EQ(hash, id.Hash());
+}
+
+} // namespace yafiyogi::yy_values::tests
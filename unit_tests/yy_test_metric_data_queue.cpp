@@ -0,0 +1,239 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+
+#include "yy_values_metric_data_queue.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+MetricData make_item(size_type p_tag)
+{
+  MetricData metric_data{};
+  metric_data.Timestamp(timestamp_type{std::chrono::nanoseconds{p_tag}});
+  metric_data.Value(fmt::format("value_{}", p_tag));
+
+  return metric_data;
+}
+
+size_type tag_of(const MetricData & p_metric_data)
+{
+  return static_cast<size_type>(p_metric_data.Timestamp().time_since_epoch().count());
+}
+
+} // anonymous namespace
+
+template<typename Queue>
+class TestMetricDataQueue:
+      public testing::Test
+{
+};
+
+using QueueTypes = testing::Types<MetricDataSpscQueue, MetricDataMpscQueue>;
+TYPED_TEST_SUITE(TestMetricDataQueue, QueueTypes);
+
+TYPED_TEST(TestMetricDataQueue, CapacityIsPowerOfTwo)
+{
+  EXPECT_EQ(2, TypeParam{0}.capacity());
+  EXPECT_EQ(8, TypeParam{5}.capacity());
+  EXPECT_EQ(8, TypeParam{8}.capacity());
+}
+
+TYPED_TEST(TestMetricDataQueue, PopEmpty)
+{
+  TypeParam queue{4};
+  auto item{make_item(7)};
+
+  EXPECT_FALSE(queue.Pop(item));
+  EXPECT_EQ(7, tag_of(item));
+  EXPECT_EQ("value_7", item.Value());
+
+  // Empty again after a push and pop.
+  ASSERT_TRUE(queue.Push(item));
+  ASSERT_TRUE(queue.Pop(item));
+  EXPECT_EQ(7, tag_of(item));
+  EXPECT_FALSE(queue.Pop(item));
+}
+
+TYPED_TEST(TestMetricDataQueue, PushFull)
+{
+  TypeParam queue{4};
+
+  for(size_type idx = 0; idx < queue.capacity(); ++idx)
+  {
+    auto item{make_item(idx)};
+    ASSERT_TRUE(queue.Push(item));
+  }
+
+  auto extra{make_item(99)};
+  EXPECT_FALSE(queue.Push(extra));
+  EXPECT_EQ(99, tag_of(extra));
+  EXPECT_EQ("value_99", extra.Value());
+
+  // One pop makes room for one push.
+  MetricData item{};
+  ASSERT_TRUE(queue.Pop(item));
+  EXPECT_EQ(0, tag_of(item));
+  EXPECT_TRUE(queue.Push(extra));
+  EXPECT_FALSE(queue.Push(item));
+
+  for(size_type idx = 1; idx <= queue.capacity(); ++idx)
+  {
+    ASSERT_TRUE(queue.Pop(item));
+    EXPECT_EQ((idx < queue.capacity()) ? idx : 99, tag_of(item));
+  }
+  EXPECT_FALSE(queue.Pop(item));
+}
+
+TYPED_TEST(TestMetricDataQueue, WrapAround)
+{
+  TypeParam queue{4};
+  size_type next_push = 0;
+  size_type next_pop = 0;
+
+  // Uneven batches so head and tail wrap at different slots.
+  for(size_type round = 0; round < 16; ++round)
+  {
+    const size_type num_push = 1 + (round % queue.capacity());
+    for(size_type idx = 0; idx < num_push; ++idx)
+    {
+      auto item{make_item(next_push)};
+      if(!queue.Push(item))
+      {
+        break;
+      }
+      ++next_push;
+    }
+
+    const size_type num_pop = 1 + ((round + 2) % queue.capacity());
+    for(size_type idx = 0; idx < num_pop; ++idx)
+    {
+      MetricData item{};
+      if(!queue.Pop(item))
+      {
+        break;
+      }
+      EXPECT_EQ(next_pop, tag_of(item));
+      EXPECT_EQ(fmt::format("value_{}", next_pop), item.Value());
+      ++next_pop;
+    }
+  }
+
+  EXPECT_GT(next_pop, 4 * queue.capacity());
+}
+
+TYPED_TEST(TestMetricDataQueue, SingleProducerInOrder)
+{
+  constexpr size_type num_items = 100000;
+  TypeParam queue{64};
+
+  std::jthread producer{[&queue]() {
+    for(size_type idx = 0; idx < num_items; ++idx)
+    {
+      auto item{make_item(idx)};
+      while(!queue.Push(item))
+      {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  MetricData item{};
+  for(size_type idx = 0; idx < num_items; ++idx)
+  {
+    while(!queue.Pop(item))
+    {
+      std::this_thread::yield();
+    }
+    EXPECT_EQ(idx, tag_of(item));
+  }
+}
+
+TEST(TestMetricDataMpscQueue, MultipleProducersExactlyOnce)
+{
+  constexpr size_type num_producers = 4;
+  constexpr size_type num_items = 50000;
+  MetricDataMpscQueue queue{64};
+
+  {
+    yy_quad::simple_vector<std::jthread> producers{};
+    producers.reserve(num_producers);
+    for(size_type producer = 0; producer < num_producers; ++producer)
+    {
+      producers.emplace_back([&queue, producer]() {
+        for(size_type idx = 0; idx < num_items; ++idx)
+        {
+          auto item{make_item((producer * num_items) + idx)};
+          while(!queue.Push(item))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    yy_quad::simple_vector<uint8_t> seen(num_producers * num_items);
+    yy_quad::simple_vector<size_type> next(num_producers);
+    MetricData item{};
+
+    for(size_type count = 0; count < (num_producers * num_items); ++count)
+    {
+      while(!queue.Pop(item))
+      {
+        std::this_thread::yield();
+      }
+
+      // Keep draining on failure, so producers are never left blocked.
+      const size_type tag = tag_of(item);
+      if(tag >= seen.size())
+      {
+        ADD_FAILURE() << "unknown item " << tag;
+        continue;
+      }
+      EXPECT_EQ(0, seen[tag]) << "item " << tag << " popped twice";
+      seen[tag] = 1;
+
+      // Each producer's items arrive in the order it pushed them.
+      const size_type producer = tag / num_items;
+      EXPECT_EQ(next[producer], tag % num_items);
+      next[producer] = (tag % num_items) + 1;
+      EXPECT_EQ(fmt::format("value_{}", tag), item.Value());
+    }
+
+    EXPECT_FALSE(queue.Pop(item));
+  }
+}
+
+} // namespace yafiyogi::yy_values::tests
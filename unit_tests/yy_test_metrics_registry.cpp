@@ -0,0 +1,135 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <variant>
+
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_values_metrics_registry.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+// Two value entries with the same id and handler give two equal specs
+// in one handler.
+constexpr std::string_view g_duplicate_yaml{
+  "- value: \"counter\"\n"
+  "  handlers:\n"
+  "    - handler_id: \"handler\"\n"
+  "      property: \"count\"\n"
+  "      rate: delta\n"
+  "- value: \"counter\"\n"
+  "  handlers:\n"
+  "    - handler_id: \"handler\"\n"
+  "      property: \"count\"\n"
+  "      rate: delta\n"};
+
+Metrics handler_metrics(const MetricsConfig & p_config)
+{
+  Metrics metrics{};
+
+  std::ignore = p_config.metrics.find_value([&metrics](auto p_handler_metrics, auto) {
+    metrics = *p_handler_metrics;
+  }, "handler");
+
+  return metrics;
+}
+
+MetricEvent make_event(std::string_view p_value,
+                       int64_t p_seconds)
+{
+  return MetricEvent{p_value,
+                     "counter",
+                     {},
+                     timestamp_type{std::chrono::seconds{p_seconds}},
+                     ValueType::Int};
+}
+
+} // anonymous namespace
+
+class TestMetricsRegistry:
+      public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+      spdlog::set_level(spdlog::level::warn);
+    }
+};
+
+TEST_F(TestMetricsRegistry, ReloadReusesEachMetricOnce)
+{
+  MetricsRegistry registry{};
+  const auto yaml_values{YAML::Load(std::string{g_duplicate_yaml})};
+
+  registry.Reload(yaml_values);
+  const auto first{handler_metrics(*registry.Acquire())};
+  ASSERT_EQ(2, first.size());
+  EXPECT_NE(first[0], first[1]);
+
+  registry.Reload(yaml_values);
+  const auto second{handler_metrics(*registry.Acquire())};
+  ASSERT_EQ(2, second.size());
+  EXPECT_EQ(first[0], second[0]);
+  EXPECT_EQ(first[1], second[1]);
+}
+
+TEST_F(TestMetricsRegistry, ReloadKeepsDuplicateContexts)
+{
+  MetricsRegistry registry{};
+  const auto yaml_values{YAML::Load(std::string{g_duplicate_yaml})};
+
+  registry.Reload(yaml_values);
+
+  MetricsReader reader{registry};
+  MetricDataVector metric_data{};
+
+  // A series' first sample is not emitted.
+  EXPECT_TRUE(reader.Event("handler", make_event("10", 1), MetricDataVectorPtr{&metric_data}));
+  EXPECT_TRUE(metric_data.empty());
+
+  registry.Reload(yaml_values);
+  EXPECT_TRUE(reader.Refresh());
+
+  // Both Metrics kept their rate state, so both emit a delta.
+  EXPECT_TRUE(reader.Event("handler", make_event("15", 2), MetricDataVectorPtr{&metric_data}));
+  ASSERT_EQ(2, metric_data.size());
+  for(const auto & data : metric_data)
+  {
+    EXPECT_EQ(5, std::get<int64_t>(data.Binary()));
+  }
+}
+
+} // namespace yafiyogi::yy_values::tests
@@ -0,0 +1,183 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <variant>
+
+#include "gtest/gtest.h"
+
+#include "yy_value_parse.hpp"
+#include "yy_values_metric_id.hpp"
+#include "yy_values_rate_cache.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+MetricData make_sample(std::string_view p_value,
+                       int64_t p_seconds)
+{
+  MetricData metric_data{MetricId{"counter", "room"}};
+  metric_data.Value(p_value);
+  metric_data.Type(ValueType::Int);
+  metric_data.Timestamp(timestamp_type{std::chrono::seconds{p_seconds}});
+  parse_value(metric_data);
+
+  return metric_data;
+}
+
+} // anonymous namespace
+
+TEST(TestRateCache, FirstSampleHasNoRate)
+{
+  RateCache cache{4};
+  auto sample{make_sample("10", 1)};
+
+  EXPECT_EQ(RateResult::First, cache.Apply(sample, RateMode::Rate));
+  EXPECT_EQ("10", sample.Value());
+  EXPECT_EQ(1, cache.size());
+}
+
+TEST(TestRateCache, Rate)
+{
+  RateCache cache{4};
+  auto first{make_sample("10", 1)};
+  auto second{make_sample("30", 3)};
+
+  std::ignore = cache.Apply(first, RateMode::Rate);
+  EXPECT_EQ(RateResult::Ok, cache.Apply(second, RateMode::Rate));
+  EXPECT_EQ(ValueType::Float, second.Type());
+  EXPECT_EQ(10.0, std::get<double>(second.Binary()));
+}
+
+TEST(TestRateCache, RateDropsStaleTimestamp)
+{
+  RateCache cache{4};
+  auto first{make_sample("10", 2)};
+  auto same{make_sample("20", 2)};
+  auto older{make_sample("30", 1)};
+  auto later{make_sample("40", 4)};
+
+  std::ignore = cache.Apply(first, RateMode::Rate);
+  EXPECT_EQ(RateResult::Stale, cache.Apply(same, RateMode::Rate));
+  EXPECT_EQ("20", same.Value());
+  EXPECT_EQ(RateResult::Stale, cache.Apply(older, RateMode::Rate));
+
+  // Stale samples are not kept, so the rate is from the first sample.
+  EXPECT_EQ(RateResult::Ok, cache.Apply(later, RateMode::Rate));
+  EXPECT_EQ(15.0, std::get<double>(later.Binary()));
+}
+
+TEST(TestRateCache, DeltaIgnoresTimestamp)
+{
+  RateCache cache{4};
+  auto first{make_sample("10", 2)};
+  auto same{make_sample("15", 2)};
+  auto older{make_sample("18", 1)};
+
+  std::ignore = cache.Apply(first, RateMode::Delta);
+  EXPECT_EQ(RateResult::Ok, cache.Apply(same, RateMode::Delta));
+  EXPECT_EQ(ValueType::Int, same.Type());
+  EXPECT_EQ(5, std::get<int64_t>(same.Binary()));
+  EXPECT_EQ("5", same.Value());
+
+  EXPECT_EQ(RateResult::Ok, cache.Apply(older, RateMode::Delta));
+  EXPECT_EQ(3, std::get<int64_t>(older.Binary()));
+}
+
+TEST(TestRateCache, CounterReset)
+{
+  RateCache cache{4};
+  auto first{make_sample("100", 1)};
+  auto reset{make_sample("7", 2)};
+
+  std::ignore = cache.Apply(first, RateMode::Delta);
+  EXPECT_EQ(RateResult::Reset, cache.Apply(reset, RateMode::Delta));
+  EXPECT_EQ(7, std::get<int64_t>(reset.Binary()));
+}
+
+TEST(TestRateCache, DeltaExtremeInt)
+{
+  RateCache cache{4};
+  auto first{make_sample("-9223372036854775808", 1)};
+  auto second{make_sample("9223372036854775807", 2)};
+  auto third{make_sample("9223372036854775807", 3)};
+  auto fourth{make_sample("-1", 4)};
+
+  std::ignore = cache.Apply(first, RateMode::Delta);
+
+  // INT64_MAX - INT64_MIN does not fit an Int.
+  EXPECT_EQ(RateResult::Ok, cache.Apply(second, RateMode::Delta));
+  EXPECT_EQ(ValueType::UInt, second.Type());
+  EXPECT_EQ(UINT64_MAX, std::get<uint64_t>(second.Binary()));
+  EXPECT_EQ("18446744073709551615", second.Value());
+
+  EXPECT_EQ(RateResult::Ok, cache.Apply(third, RateMode::Delta));
+  EXPECT_EQ(ValueType::Int, third.Type());
+  EXPECT_EQ(0, std::get<int64_t>(third.Binary()));
+
+  EXPECT_EQ(RateResult::Reset, cache.Apply(fourth, RateMode::Delta));
+  EXPECT_EQ(-1, std::get<int64_t>(fourth.Binary()));
+}
+
+TEST(TestRateCache, RateExtremeInt)
+{
+  RateCache cache{4};
+  auto first{make_sample("-9223372036854775808", 1)};
+  auto second{make_sample("9223372036854775807", 2)};
+
+  std::ignore = cache.Apply(first, RateMode::Rate);
+  EXPECT_EQ(RateResult::Ok, cache.Apply(second, RateMode::Rate));
+  EXPECT_DOUBLE_EQ(18446744073709551615.0, std::get<double>(second.Binary()));
+}
+
+TEST(TestRateCache, UnparsedValue)
+{
+  RateCache cache{4};
+  auto first{make_sample("10", 1)};
+  auto invalid{make_sample("ten", 2)};
+
+  std::ignore = cache.Apply(first, RateMode::Delta);
+  EXPECT_NE(ValueStatus::Ok, invalid.Status());
+  EXPECT_EQ(RateResult::Unparsed, cache.Apply(invalid, RateMode::Delta));
+  EXPECT_EQ("ten", invalid.Value());
+}
+
+TEST(TestRateCache, OffPassesThrough)
+{
+  RateCache cache{4};
+  auto sample{make_sample("10", 1)};
+
+  EXPECT_EQ(RateResult::Ok, cache.Apply(sample, RateMode::Off));
+  EXPECT_EQ("10", sample.Value());
+  EXPECT_EQ(0, cache.size());
+}
+
+} // namespace yafiyogi::yy_values::tests
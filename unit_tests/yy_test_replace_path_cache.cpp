@@ -0,0 +1,186 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_replace_path_cache.hpp"
+#include "yy_values_metric_spec.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+constexpr std::string_view g_values_yaml =
+  "- value: \"temperature\"\n"
+  "  handlers:\n"
+  "    - handler_id: \"handler\"\n"
+  "      property: \"temp\"\n"
+  "      replace_path_cache: 16\n"
+  "      label_actions:\n"
+  "        - action: replace-path\n"
+  "          target: device\n"
+  "          replace:\n"
+  "            - pattern: \"site/+/+/#\"\n"
+  "              format: \"\\\\3\"\n";
+
+ReplacePathSpec make_spec(std::string_view p_pattern,
+                          std::string_view p_prefix)
+{
+  ReplaceFormat format{};
+  format.emplace_back(std::in_place_type_t<FormatPrefix>{}, p_prefix);
+
+  return ReplacePathSpec{std::string{p_pattern}, std::move(format)};
+}
+
+const ReplaceFormat * prefix_of(const ReplaceFormat * p_format,
+                                std::string_view p_prefix)
+{
+  if((nullptr != p_format)
+     && (1 == p_format->size())
+     && (std::get<FormatPrefix>((*p_format)[0]).Prefix() == p_prefix))
+  {
+    return p_format;
+  }
+
+  return nullptr;
+}
+
+} // anonymous namespace
+
+class TestReplacePathCache:
+      public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+      ReplacePathSpecs specs{};
+      specs.emplace_back(make_spec("site/#", "site"));
+      specs.emplace_back(make_spec("other/#", "other"));
+
+      topics = create_replacement_topics(specs);
+    }
+
+    ReplacementTopics topics{};
+};
+
+TEST_F(TestReplacePathCache, CapacityIsPowerOfTwo)
+{
+  EXPECT_EQ(1, ReplacePathCache{0}.capacity());
+  EXPECT_EQ(128, ReplacePathCache{100}.capacity());
+  EXPECT_EQ(replace_path_cache_detail::default_capacity, ReplacePathCache{}.capacity());
+}
+
+TEST_F(TestReplacePathCache, HitMissAndEviction)
+{
+  // One entry, so every new topic evicts the previous one.
+  ReplacePathCache cache{1};
+
+  EXPECT_NE(nullptr, prefix_of(cache.find(topics, "site/1"), "site"));
+  EXPECT_NE(nullptr, prefix_of(cache.find(topics, "site/1"), "site"));
+  EXPECT_NE(nullptr, prefix_of(cache.find(topics, "other/1"), "other"));
+
+  const auto & stats = cache.stats();
+  EXPECT_EQ(1, stats.hits);
+  EXPECT_EQ(2, stats.misses);
+  EXPECT_EQ(1, stats.evictions);
+}
+
+TEST_F(TestReplacePathCache, NegativeCache)
+{
+  ReplacePathCache cache{1};
+
+  EXPECT_EQ(nullptr, cache.find(topics, "unmatched/1"));
+  EXPECT_EQ(nullptr, cache.find(topics, "unmatched/1"));
+
+  // The second lookup is a hit on the cached miss.
+  const auto & stats = cache.stats();
+  EXPECT_EQ(1, stats.hits);
+  EXPECT_EQ(1, stats.misses);
+  EXPECT_EQ(0, stats.evictions);
+
+  EXPECT_NE(nullptr, cache.find(topics, "site/1"));
+  EXPECT_EQ(1, stats.evictions);
+}
+
+TEST_F(TestReplacePathCache, ClearResetsEntriesAndStats)
+{
+  ReplacePathCache cache{4};
+
+  std::ignore = cache.find(topics, "site/1");
+  cache.clear();
+
+  EXPECT_EQ(0, cache.stats().misses);
+  EXPECT_NE(nullptr, cache.find(topics, "site/1"));
+  EXPECT_EQ(0, cache.stats().hits);
+  EXPECT_EQ(1, cache.stats().misses);
+  EXPECT_EQ(0, cache.stats().evictions);
+}
+
+TEST_F(TestReplacePathCache, ProgramCachesUseCapacity)
+{
+  LabelActionProgram program{};
+  program.add_replace_path(LabelId{}, topics);
+  program.add_replace_path(LabelId{}, topics);
+
+  auto caches{program.create_caches(8)};
+
+  ASSERT_EQ(2, caches.size());
+  EXPECT_EQ(8, caches[0].capacity());
+  EXPECT_EQ(8, caches[1].capacity());
+}
+
+TEST_F(TestReplacePathCache, MetricContextUsesConfiguredCapacity)
+{
+  spdlog::set_level(spdlog::level::warn);
+
+  auto metrics{configure_values(YAML::Load(std::string{g_values_yaml}))};
+  ASSERT_EQ(1, metrics.size());
+
+  auto [ignore_key, handler_metrics] = metrics[0];
+  ASSERT_EQ(1, handler_metrics.size());
+
+  const auto & metric = *handler_metrics[0];
+  EXPECT_EQ(16, metric.CacheCapacity());
+
+  auto context{metric.CreateContext()};
+  size_type num_caches = 0;
+  metric.VisitCacheStats(context, [&num_caches](LabelId, const ReplacePathCache::Stats &) {
+    ++num_caches;
+  });
+  EXPECT_EQ(1, num_caches);
+}
+
+} // namespace yafiyogi::yy_values::tests
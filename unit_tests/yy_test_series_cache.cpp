@@ -0,0 +1,291 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_values_label_id.hpp"
+#include "yy_values_labels.hpp"
+#include "yy_values_metric.hpp"
+#include "yy_values_metric_id.hpp"
+#include "yy_values_series_cache.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+// One more label than hash bits, so some subset's hashes XOR to zero.
+constexpr std::size_t g_num_collide_labels = 65;
+
+using LabelSet = std::bitset<g_num_collide_labels>;
+
+constexpr std::string_view g_values_yaml =
+  "- value: \"temperature\"\n"
+  "  handlers:\n"
+  "    - handler_id: \"mark\"\n"
+  "      property: \"temp\"\n"
+  "      dedup: mark\n"
+  "    - handler_id: \"suppress\"\n"
+  "      property: \"temp\"\n"
+  "      dedup: suppress\n";
+
+timestamp_type at(int64_t p_seconds)
+{
+  return timestamp_type{std::chrono::seconds{p_seconds}};
+}
+
+MetricData sample(std::string_view p_device,
+                  std::string_view p_value,
+                  int64_t p_seconds)
+{
+  MetricData metric_data{MetricId{"temperature", "room"}};
+  metric_data.Labels().set_label(intern_label("device"), p_device);
+  metric_data.Value(p_value);
+  metric_data.Timestamp(at(p_seconds));
+
+  return metric_data;
+}
+
+DedupConfig dedup(std::chrono::seconds p_heartbeat,
+                  std::chrono::seconds p_expiry)
+{
+  return DedupConfig{DedupMode::Suppress, p_heartbeat, p_expiry};
+}
+
+// Labels are hashed as the XOR of one hash per label, so a linear
+// dependency between label hashes gives two distinct label sets with
+// the same hash. Gaussian elimination over GF(2) finds one.
+LabelSet colliding_labels(const std::array<LabelId, g_num_collide_labels> & p_labels)
+{
+  std::array<uint64_t, 64> basis{};
+  std::array<LabelSet, 64> basis_sets{};
+
+  for(std::size_t idx = 0; idx < p_labels.size(); ++idx)
+  {
+    uint64_t hash = Labels::hash(p_labels[idx], "x");
+    LabelSet set{};
+    set.set(idx);
+
+    for(int bit = 63; (0 != hash) && (bit >= 0); --bit)
+    {
+      if(0 == ((hash >> bit) & 1))
+      {
+        continue;
+      }
+
+      if(0 == basis[static_cast<std::size_t>(bit)])
+      {
+        basis[static_cast<std::size_t>(bit)] = hash;
+        basis_sets[static_cast<std::size_t>(bit)] = set;
+        break;
+      }
+
+      hash ^= basis[static_cast<std::size_t>(bit)];
+      set ^= basis_sets[static_cast<std::size_t>(bit)];
+    }
+
+    if(0 == hash)
+    {
+      return set;
+    }
+  }
+
+  return LabelSet{};
+}
+
+} // anonymous namespace
+
+TEST(TestSeriesCache, SuppressesUnchanged)
+{
+  SeriesCache cache{};
+  const auto config{dedup(std::chrono::seconds{0}, std::chrono::seconds{0})};
+
+  EXPECT_FALSE(cache.Unchanged(sample("dev", "20", 0), config));
+  EXPECT_TRUE(cache.Unchanged(sample("dev", "20", 1), config));
+  EXPECT_FALSE(cache.Unchanged(sample("dev", "21", 2), config));
+  EXPECT_TRUE(cache.Unchanged(sample("dev", "21", 3), config));
+
+  // Another series has its own last value.
+  EXPECT_FALSE(cache.Unchanged(sample("other", "21", 4), config));
+  EXPECT_EQ(2, cache.size());
+
+  cache.clear();
+  EXPECT_FALSE(cache.Unchanged(sample("dev", "21", 5), config));
+}
+
+TEST(TestSeriesCache, Heartbeat)
+{
+  SeriesCache cache{};
+  const auto config{dedup(std::chrono::seconds{30}, std::chrono::seconds{0})};
+
+  EXPECT_FALSE(cache.Unchanged(sample("dev", "20", 0), config));
+  EXPECT_TRUE(cache.Unchanged(sample("dev", "20", 10), config));
+  EXPECT_TRUE(cache.Unchanged(sample("dev", "20", 29), config));
+
+  // Emitted again once the heartbeat has passed since the last emit.
+  EXPECT_FALSE(cache.Unchanged(sample("dev", "20", 30), config));
+  EXPECT_TRUE(cache.Unchanged(sample("dev", "20", 59), config));
+  EXPECT_FALSE(cache.Unchanged(sample("dev", "20", 60), config));
+
+  // A change resets the heartbeat.
+  EXPECT_FALSE(cache.Unchanged(sample("dev", "21", 75), config));
+  EXPECT_TRUE(cache.Unchanged(sample("dev", "21", 100), config));
+}
+
+TEST(TestSeriesCache, ExpiresIdleSeries)
+{
+  // Enough series to fill the smallest table, so the next new series
+  // makes room by dropping expired ones.
+  constexpr size_type num_series = 12;
+
+  for(const auto expiry : {std::chrono::seconds{60}, std::chrono::seconds{0}})
+  {
+    SCOPED_TRACE(expiry.count());
+
+    SeriesCache cache{};
+    const auto config{dedup(std::chrono::seconds{0}, expiry)};
+
+    for(size_type idx = 0; idx < num_series; ++idx)
+    {
+      EXPECT_FALSE(cache.Unchanged(sample(fmt::format("dev_{}", idx), "20", 0), config));
+    }
+    EXPECT_EQ(num_series, cache.size());
+
+    EXPECT_FALSE(cache.Unchanged(sample("late", "20", 100), config));
+
+    if(std::chrono::seconds{0} == expiry)
+    {
+      EXPECT_EQ(num_series + 1, cache.size());
+      EXPECT_TRUE(cache.Unchanged(sample("dev_0", "20", 101), config));
+    }
+    else
+    {
+      // An expired series is forgotten, so its next sample is emitted.
+      EXPECT_EQ(1, cache.size());
+      EXPECT_FALSE(cache.Unchanged(sample("dev_0", "20", 101), config));
+    }
+  }
+}
+
+TEST(TestSeriesCache, SameHashDifferentIdentity)
+{
+  std::array<LabelId, g_num_collide_labels> labels{};
+  for(std::size_t idx = 0; idx < labels.size(); ++idx)
+  {
+    labels[idx] = intern_label(fmt::format("collide_{}", idx));
+  }
+
+  const auto set{colliding_labels(labels)};
+  ASSERT_LE(2, set.count());
+
+  // Split the set: the first label on one side, the rest on the other.
+  MetricData first{MetricId{"temperature", "room"}};
+  MetricData rest{MetricId{"temperature", "room"}};
+  bool is_first = true;
+
+  for(std::size_t idx = 0; idx < labels.size(); ++idx)
+  {
+    if(set.test(idx))
+    {
+      (is_first ? first : rest).Labels().set_label(labels[idx], "x");
+      is_first = false;
+    }
+  }
+
+  ASSERT_EQ(first.Labels().Hash(), rest.Labels().Hash());
+  ASSERT_FALSE(first.Labels() == rest.Labels());
+
+  SeriesCache cache{};
+  const auto config{dedup(std::chrono::seconds{0}, std::chrono::seconds{0})};
+
+  first.Value("20");
+  rest.Value("20");
+  EXPECT_FALSE(cache.Unchanged(first, config));
+  EXPECT_FALSE(cache.Unchanged(rest, config));
+  EXPECT_EQ(2, cache.size());
+
+  EXPECT_TRUE(cache.Unchanged(first, config));
+  rest.Value("21");
+  EXPECT_FALSE(cache.Unchanged(rest, config));
+  EXPECT_TRUE(cache.Unchanged(first, config));
+  EXPECT_TRUE(cache.Unchanged(rest, config));
+}
+
+TEST(TestSeriesCache, MarkAndSuppressModes)
+{
+  spdlog::set_level(spdlog::level::warn);
+
+  auto metrics{configure_values(YAML::Load(std::string{g_values_yaml}))};
+  ASSERT_EQ(2, metrics.size());
+
+  for(size_type idx = 0; idx < metrics.size(); ++idx)
+  {
+    auto [handler_id, handler_metrics] = metrics[idx];
+    ASSERT_EQ(1, handler_metrics.size());
+    const auto & metric = *handler_metrics[0];
+    auto context{metric.CreateContext()};
+    const bool is_mark = ("mark" == handler_id);
+
+    MetricDataVector metric_data{};
+    for(std::string_view value : {"20", "20", "21", "21"})
+    {
+      EXPECT_TRUE(metric.Event(context,
+                               MetricEvent{value, "sensor", {}, timestamp_type{}, ValueType::Float},
+                               MetricDataVectorPtr{&metric_data}));
+    }
+
+    if(is_mark)
+    {
+      // Every sample is emitted, repeats marked Unchanged.
+      ASSERT_EQ(4, metric_data.size());
+      EXPECT_FALSE(metric_data[0].Unchanged());
+      EXPECT_TRUE(metric_data[1].Unchanged());
+      EXPECT_FALSE(metric_data[2].Unchanged());
+      EXPECT_TRUE(metric_data[3].Unchanged());
+    }
+    else
+    {
+      ASSERT_EQ(2, metric_data.size());
+      EXPECT_EQ("20", metric_data[0].Value());
+      EXPECT_EQ("21", metric_data[1].Value());
+      EXPECT_FALSE(metric_data[0].Unchanged());
+      EXPECT_FALSE(metric_data[1].Unchanged());
+    }
+  }
+}
+
+} // namespace yafiyogi::yy_values::tests
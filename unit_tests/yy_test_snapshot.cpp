@@ -0,0 +1,269 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_values_snapshot.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+// Every kind of spec the snapshot stores.
+constexpr std::string_view g_values_yaml =
+  "- value: \"temperature\"\n"
+  "  handlers:\n"
+  "    - handler_id: \"handler\"\n"
+  "      property: \"temp\"\n"
+  "      location:\n"
+  "        - pattern: \"site/+/#\"\n"
+  "          format: \"site-\\\\2\"\n"
+  "      label_actions:\n"
+  "        - action: copy\n"
+  "          source: location\n"
+  "          target: site\n"
+  "        - action: replace-path\n"
+  "          target: device\n"
+  "          replace:\n"
+  "            - pattern: \"site/+/+/#\"\n"
+  "              format: \"dev-\\\\3\"\n"
+  "        - action: drop\n"
+  "          target: topic\n"
+  "      value_actions:\n"
+  "        - action: convert\n"
+  "          from: celsius\n"
+  "          to: fahrenheit\n"
+  "          default: \"-1\"\n"
+  "        - action: clamp\n"
+  "          min: -40\n"
+  "          max: 150\n"
+  "        - action: round\n"
+  "          digits: 1\n"
+  "      dedup:\n"
+  "        mode: mark\n"
+  "        heartbeat: 60\n"
+  "      rate: delta\n"
+  "    - handler_id: \"other\"\n"
+  "      property: \"temp\"\n"
+  "      value_actions:\n"
+  "        - action: range\n"
+  "          default: \"unknown\"\n"
+  "          ranges:\n"
+  "            - below: 10\n"
+  "              value: \"cold\"\n"
+  "            - value: \"warm\"\n"
+  "- value: \"state\"\n"
+  "  handlers:\n"
+  "    - handler_id: \"handler\"\n"
+  "      property: \"state\"\n"
+  "      value_actions:\n"
+  "        - action: switch\n"
+  "          default: \"unknown\"\n"
+  "          mappings:\n"
+  "            \"0\": \"off\"\n"
+  "            \"1\": \"on\"\n";
+
+constexpr uint64_t g_source_hash = 0x1234'5678'9abc'def0;
+
+// Bytes before the header's version field, and in the whole header.
+constexpr std::size_t g_version_offset = 4;
+constexpr std::size_t g_header_size = 32;
+
+} // anonymous namespace
+
+class TestSnapshot:
+      public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+      spdlog::set_level(spdlog::level::warn);
+
+      dir = std::filesystem::temp_directory_path() / fmt::format("yy_test_snapshot_{}", ::getpid());
+      std::filesystem::create_directories(dir);
+      snapshot_file = (dir / "values.snapshot").string();
+
+      specs = configure_metric_specs(YAML::Load(std::string{g_values_yaml}));
+      ASSERT_EQ(3, specs.size());
+      ASSERT_TRUE(save_snapshot(snapshot_file, specs, g_source_hash));
+    }
+
+    void TearDown() override
+    {
+      std::error_code ec{};
+      std::filesystem::remove_all(dir, ec);
+    }
+
+    std::string read_snapshot() const
+    {
+      std::ifstream in{snapshot_file, std::ios::binary};
+
+      return std::string{std::istreambuf_iterator<char>{in},
+                         std::istreambuf_iterator<char>{}};
+    }
+
+    void write_snapshot(std::string_view p_data) const
+    {
+      std::ofstream out{snapshot_file, std::ios::binary | std::ios::trunc};
+      out.write(p_data.data(), static_cast<std::streamsize>(p_data.size()));
+    }
+
+    void expect_loads_specs() const
+    {
+      const auto loaded{load_snapshot(snapshot_file, g_source_hash)};
+      ASSERT_TRUE(loaded.has_value());
+      ASSERT_EQ(specs.size(), loaded.value().size());
+
+      for(size_type idx = 0; idx < specs.size(); ++idx)
+      {
+        EXPECT_TRUE(specs[idx] == loaded.value()[idx]) << "spec " << idx;
+      }
+    }
+
+    std::filesystem::path dir{};
+    std::string snapshot_file{};
+    MetricSpecs specs{};
+};
+
+TEST_F(TestSnapshot, RoundTrip)
+{
+  expect_loads_specs();
+
+  // Saving what was loaded gives the same bytes.
+  const auto bytes{read_snapshot()};
+  const auto loaded{load_snapshot(snapshot_file, g_source_hash)};
+  ASSERT_TRUE(loaded.has_value());
+  ASSERT_TRUE(save_snapshot(snapshot_file, loaded.value(), g_source_hash));
+  EXPECT_EQ(bytes, read_snapshot());
+}
+
+TEST_F(TestSnapshot, EmptySpecs)
+{
+  ASSERT_TRUE(save_snapshot(snapshot_file, MetricSpecs{}, g_source_hash));
+
+  const auto loaded{load_snapshot(snapshot_file, g_source_hash)};
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_TRUE(loaded.value().empty());
+}
+
+TEST_F(TestSnapshot, Missing)
+{
+  EXPECT_FALSE(load_snapshot((dir / "missing.snapshot").string(), g_source_hash).has_value());
+}
+
+TEST_F(TestSnapshot, SourceHashMismatch)
+{
+  EXPECT_FALSE(load_snapshot(snapshot_file, g_source_hash + 1).has_value());
+}
+
+TEST_F(TestSnapshot, Truncated)
+{
+  const auto bytes{read_snapshot()};
+  ASSERT_LT(g_header_size, bytes.size());
+
+  for(std::size_t size : {std::size_t{0},
+                          g_version_offset + sizeof(uint32_t),
+                          g_header_size,
+                          bytes.size() / 2,
+                          bytes.size() - 1})
+  {
+    write_snapshot(std::string_view{bytes}.substr(0, size));
+    EXPECT_FALSE(load_snapshot(snapshot_file, g_source_hash).has_value()) << size << " bytes";
+  }
+
+  write_snapshot(bytes);
+  expect_loads_specs();
+}
+
+TEST_F(TestSnapshot, BadMagic)
+{
+  auto bytes{read_snapshot()};
+  bytes[0] = static_cast<char>(bytes[0] ^ 0x20);
+  write_snapshot(bytes);
+
+  EXPECT_FALSE(load_snapshot(snapshot_file, g_source_hash).has_value());
+}
+
+TEST_F(TestSnapshot, BadVersion)
+{
+  const auto bytes{read_snapshot()};
+
+  uint32_t version = 0;
+  std::memcpy(&version, bytes.data() + g_version_offset, sizeof(version));
+  ASSERT_EQ(snapshot_version, version);
+
+  for(uint32_t bad_version : {snapshot_version - 1, snapshot_version + 1})
+  {
+    auto bad_bytes{bytes};
+    std::memcpy(bad_bytes.data() + g_version_offset, &bad_version, sizeof(bad_version));
+    write_snapshot(bad_bytes);
+
+    EXPECT_FALSE(load_snapshot(snapshot_file, g_source_hash).has_value()) << "version " << bad_version;
+  }
+}
+
+TEST_F(TestSnapshot, CorruptPayload)
+{
+  auto bytes{read_snapshot()};
+  bytes.back() = static_cast<char>(bytes.back() ^ 0x01);
+  write_snapshot(bytes);
+
+  EXPECT_FALSE(load_snapshot(snapshot_file, g_source_hash).has_value());
+}
+
+TEST_F(TestSnapshot, LoadValuesWritesThenReadsSnapshot)
+{
+  const auto config_file{(dir / "values.yaml").string()};
+  const auto values_snapshot{(dir / "load_values.snapshot").string()};
+  {
+    std::ofstream out{config_file, std::ios::binary};
+    out << g_values_yaml;
+  }
+
+  const auto configured{load_values(config_file, values_snapshot, "")};
+  ASSERT_TRUE(std::filesystem::exists(values_snapshot));
+
+  const auto from_snapshot{load_values(config_file, values_snapshot, "")};
+  EXPECT_EQ(configured.size(), from_snapshot.size());
+  EXPECT_EQ(2, from_snapshot.size());
+}
+
+} // namespace yafiyogi::yy_values::tests
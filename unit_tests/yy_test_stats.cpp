@@ -0,0 +1,270 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_label_action_replace_path.hpp"
+#include "yy_value_action_switch.hpp"
+#include "yy_values_metric.hpp"
+#include "yy_values_stats.hpp"
+#include "yy_values_topic_levels.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+constexpr std::string_view g_values_yaml =
+  "- value: \"state\"\n"
+  "  handlers:\n"
+  "    - handler_id: \"handler\"\n"
+  "      property: \"state\"\n"
+  "      label_actions:\n"
+  "        - action: replace-path\n"
+  "          target: device\n"
+  "          replace:\n"
+  "            - pattern: \"site/+/+/#\"\n"
+  "              format: \"\\\\3\"\n"
+  "      value_actions:\n"
+  "        - action: switch\n"
+  "          default: \"unknown\"\n"
+  "          mappings:\n"
+  "            \"0\": \"off\"\n"
+  "            \"1\": \"on\"\n";
+
+struct StatsEvent
+{
+    std::string_view value{};
+    std::string_view topic{};
+};
+
+// One switch miss and one replace-path miss.
+constexpr std::array<StatsEvent, 4> g_events{StatsEvent{"1", "site/1/dev_1/sensor"},
+                                             StatsEvent{"0", "site/1/dev_1/sensor"},
+                                             StatsEvent{"2", "site/2/dev_2/sensor"},
+                                             StatsEvent{"1", "other/topic"}};
+
+const ActionSnapshot * find_action(const ActionSnapshots & p_actions,
+                                   std::string_view p_name)
+{
+  for(const auto & action : p_actions)
+  {
+    if(p_name == action.name)
+    {
+      return &action;
+    }
+  }
+
+  return nullptr;
+}
+
+} // anonymous namespace
+
+class TestStats:
+      public testing::Test
+{
+  public:
+    void SetUp() override
+    {
+      spdlog::set_level(spdlog::level::warn);
+
+      auto metrics{configure_values(YAML::Load(std::string{g_values_yaml}))};
+      ASSERT_EQ(1, metrics.size());
+
+      auto [ignore_key, handler_metrics] = metrics[0];
+      ASSERT_EQ(1, handler_metrics.size());
+      metric = handler_metrics[0];
+    }
+
+    void Run(MetricContext & p_context,
+             size_type p_rounds) const
+    {
+      yy_quad::simple_vector<yy_mqtt::TopicLevelsView> levels{};
+      levels.resize(g_events.size());
+      for(size_type idx = 0; idx < g_events.size(); ++idx)
+      {
+        topic_levels(g_events[idx].topic, levels[idx]);
+      }
+
+      MetricDataVector metric_data{};
+      for(size_type round = 0; round < p_rounds; ++round)
+      {
+        for(size_type idx = 0; idx < g_events.size(); ++idx)
+        {
+          metric->Event(p_context,
+                        g_events[idx].value,
+                        g_events[idx].topic,
+                        levels[idx],
+                        timestamp_type{},
+                        ValueType::String,
+                        MetricDataVectorPtr{&metric_data});
+        }
+        metric_data.clear(yy_data::ClearAction::Keep);
+      }
+    }
+
+    MetricPtr metric{};
+};
+
+#if defined(YY_VALUES_STATS)
+
+TEST_F(TestStats, ActionCallsAndMisses)
+{
+  auto context{metric->CreateContext()};
+  constexpr size_type rounds = 3;
+  Run(context, rounds);
+
+  const auto stats{metric->Stats(context)};
+  EXPECT_EQ(rounds * g_events.size(), stats.events);
+
+  const auto * replace_path = find_action(stats.label_actions, ReplacePathLabelAction::action_name);
+  ASSERT_NE(nullptr, replace_path);
+  EXPECT_EQ(rounds * g_events.size(), replace_path->calls);
+  EXPECT_EQ(rounds, replace_path->misses);
+
+  const auto * value_switch = find_action(stats.value_actions, SwitchValueAction::action_name);
+  ASSERT_NE(nullptr, value_switch);
+  EXPECT_EQ(rounds * g_events.size(), value_switch->calls);
+  EXPECT_EQ(rounds, value_switch->misses);
+
+  // Every event is timed.
+  EXPECT_EQ(stats.events, stats.event_latency.count);
+  uint64_t bucketed = 0;
+  for(const auto bucket : stats.event_latency.buckets)
+  {
+    bucketed += bucket;
+  }
+  EXPECT_EQ(stats.events, bucketed);
+}
+
+TEST(TestLatencyHistogram, BucketPlacement)
+{
+  LatencyHistogram histogram{};
+
+  // Bucket n holds [2^(n-1), 2^n); the last bucket holds the rest.
+  histogram.record(0);
+  histogram.record(1);
+  histogram.record(2);
+  histogram.record(3);
+  histogram.record(4);
+  histogram.record(1023);
+  histogram.record(1024);
+  histogram.record(uint64_t{1} << 40);
+
+  const auto snapshot{histogram.snapshot()};
+  EXPECT_EQ(8, snapshot.count);
+  EXPECT_EQ(0 + 1 + 2 + 3 + 4 + 1023 + 1024 + (uint64_t{1} << 40), snapshot.sum_ns);
+
+  std::array<uint64_t, stats_detail::latency_buckets> expected{};
+  expected[0] = 1;
+  expected[1] = 1;
+  expected[2] = 2;
+  expected[3] = 1;
+  expected[10] = 1;
+  expected[11] = 1;
+  expected[stats_detail::latency_buckets - 1] = 1;
+  EXPECT_EQ(expected, snapshot.buckets);
+}
+
+TEST_F(TestStats, MergeAcrossThreads)
+{
+  auto context_a{metric->CreateContext()};
+  auto context_b{metric->CreateContext()};
+
+  std::thread thread_a{[this, &context_a]() { Run(context_a, 2); }};
+  std::thread thread_b{[this, &context_b]() { Run(context_b, 5); }};
+  thread_a.join();
+  thread_b.join();
+
+  const auto stats_a{metric->Stats(context_a)};
+  const auto stats_b{metric->Stats(context_b)};
+  EXPECT_EQ(2 * g_events.size(), stats_a.events);
+  EXPECT_EQ(5 * g_events.size(), stats_b.events);
+
+  auto latency{stats_a.event_latency};
+  latency.merge(stats_b.event_latency);
+  EXPECT_EQ(stats_a.event_latency.count + stats_b.event_latency.count, latency.count);
+  EXPECT_EQ(stats_a.event_latency.sum_ns + stats_b.event_latency.sum_ns, latency.sum_ns);
+  for(size_type idx = 0; idx < latency.buckets.size(); ++idx)
+  {
+    EXPECT_EQ(stats_a.event_latency.buckets[idx] + stats_b.event_latency.buckets[idx], latency.buckets[idx]);
+  }
+
+  MetricStatsSnapshot merged{};
+  merged.merge(stats_a);
+  merged.merge(stats_b);
+  EXPECT_EQ(7 * g_events.size(), merged.events);
+  EXPECT_EQ(7 * g_events.size(), merged.event_latency.count);
+
+  const auto * value_switch = find_action(merged.value_actions, SwitchValueAction::action_name);
+  ASSERT_NE(nullptr, value_switch);
+  EXPECT_EQ(7 * g_events.size(), value_switch->calls);
+  EXPECT_EQ(7, value_switch->misses);
+}
+
+#else
+
+TEST_F(TestStats, CompiledOutReportsZeros)
+{
+  static_assert(!g_stats_enabled);
+  static_assert(std::is_empty_v<StatCounter>);
+
+  auto context{metric->CreateContext()};
+  Run(context, 3);
+
+  const auto stats{metric->Stats(context)};
+  EXPECT_EQ(0, stats.events);
+  EXPECT_EQ(0, stats.event_latency.count);
+  EXPECT_EQ(0, stats.event_latency.sum_ns);
+  for(const auto bucket : stats.event_latency.buckets)
+  {
+    EXPECT_EQ(0, bucket);
+  }
+
+  // Action names are still filled in.
+  const auto * value_switch = find_action(stats.value_actions, SwitchValueAction::action_name);
+  ASSERT_NE(nullptr, value_switch);
+  EXPECT_EQ(0, value_switch->calls);
+  EXPECT_EQ(0, value_switch->misses);
+
+  LatencyHistogram histogram{};
+  histogram.record(1024);
+  EXPECT_EQ(0, histogram.snapshot().count);
+}
+
+#endif
+
+} // namespace yafiyogi::yy_values::tests
@@ -0,0 +1,261 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "fmt/format.h"
+#include "gtest/gtest.h"
+
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_value_action_switch.hpp"
+#include "yy_value_switch_table.hpp"
+#include "yy_values_metric_data.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+using Switch = SwitchTable::Switch;
+using Strategy = SwitchTable::Strategy;
+using Keys = yy_quad::simple_vector<std::string>;
+
+constexpr std::initializer_list<Strategy> all_strategies{Strategy::Linear,
+                                                         Strategy::Binary,
+                                                         Strategy::PerfectHash};
+
+Switch make_switch(const Keys & p_keys)
+{
+  Switch values{};
+
+  values.reserve(p_keys.size());
+  for(size_type idx = 0; idx < p_keys.size(); ++idx)
+  {
+    values.emplace(std::string{p_keys[idx]},
+                   fmt::format("value_{}", idx));
+  }
+
+  return values;
+}
+
+Keys small_keys()
+{
+  Keys keys{};
+  for(std::string_view key : {"on", "off", "idle", "error", "offline"})
+  {
+    keys.emplace_back(key);
+  }
+
+  return keys;
+}
+
+Keys large_keys(size_type p_num_keys)
+{
+  Keys keys{};
+  keys.reserve(p_num_keys);
+  for(size_type idx = 0; idx < p_num_keys; ++idx)
+  {
+    keys.emplace_back(fmt::format("key_{}", idx));
+  }
+
+  return keys;
+}
+
+// Keys sharing the 8 byte prefix the linear scan compares first, keys
+// that are prefixes of each other, an embedded NUL and the empty key.
+Keys colliding_keys()
+{
+  Keys keys{};
+  for(std::string_view key : {"", "a", "ab", "abcdefgh", "abcdefghi", "abcdefghj",
+                              "abcdefgh_long_tail_1", "abcdefgh_long_tail_2",
+                              "ABCDEFGH", "abcdefg"})
+  {
+    keys.emplace_back(key);
+  }
+  keys.emplace_back(std::string{"a\0", 2});
+  keys.emplace_back(std::string{"abcdefgh\0", 9});
+
+  return keys;
+}
+
+Keys miss_probes(const Keys & p_keys)
+{
+  Keys probes{};
+  for(const auto & key : p_keys)
+  {
+    probes.emplace_back(key + "x");
+    probes.emplace_back(std::string{"x"} + key);
+    if(!key.empty())
+    {
+      probes.emplace_back(key.substr(0, key.size() - 1) + "\x7f");
+    }
+  }
+  probes.emplace_back("missing");
+  probes.emplace_back(std::string{"\0", 1});
+
+  return probes;
+}
+
+std::optional<std::string_view> reference_find(const Switch & p_switch,
+                                               const std::string & p_key)
+{
+  std::optional<std::string_view> output{};
+
+  auto do_find = [&output](auto p_value, auto) {
+    output = std::string_view{*p_value};
+  };
+
+  std::ignore = p_switch.find_value(do_find, p_key);
+
+  return output;
+}
+
+// Checks every key and every miss probe against the flat_map.
+void expect_matches_reference(const SwitchTable & p_table,
+                              const Switch & p_switch,
+                              const Keys & p_keys)
+{
+  ASSERT_EQ(p_switch.size(), p_table.size());
+
+  for(const auto & key : p_keys)
+  {
+    const auto expected{reference_find(p_switch, key)};
+    ASSERT_TRUE(expected.has_value());
+    EXPECT_EQ(expected, p_table.find(key)) << "key [" << key << "]";
+  }
+
+  for(const auto & probe : miss_probes(p_keys))
+  {
+    EXPECT_EQ(reference_find(p_switch, probe), p_table.find(probe)) << "probe [" << probe << "]";
+  }
+}
+
+void expect_all_strategies_match(const Keys & p_keys)
+{
+  const auto values{make_switch(p_keys)};
+
+  for(auto strategy : all_strategies)
+  {
+    const SwitchTable table{values, strategy};
+
+    EXPECT_EQ(strategy, table.strategy());
+    EXPECT_FALSE(table.fell_back());
+    expect_matches_reference(table, values, p_keys);
+  }
+}
+
+} // anonymous namespace
+
+TEST(TestSwitchTable, SmallKeys)
+{
+  expect_all_strategies_match(small_keys());
+}
+
+TEST(TestSwitchTable, LargeKeys)
+{
+  expect_all_strategies_match(large_keys(1000));
+}
+
+TEST(TestSwitchTable, CollidingKeys)
+{
+  expect_all_strategies_match(colliding_keys());
+}
+
+TEST(TestSwitchTable, Empty)
+{
+  const Switch values{};
+
+  for(auto strategy : all_strategies)
+  {
+    const SwitchTable table{values, strategy};
+
+    EXPECT_EQ(size_type{0}, table.size());
+    EXPECT_FALSE(table.find("").has_value());
+    EXPECT_FALSE(table.find("key").has_value());
+  }
+}
+
+TEST(TestSwitchTable, PerfectHashFallsBack)
+{
+  // No seeds to try, so the displace search fails.
+  for(const auto & keys : {small_keys(), large_keys(100), colliding_keys()})
+  {
+    const auto values{make_switch(keys)};
+    const SwitchTable table{values, Strategy::PerfectHash, 0};
+
+    EXPECT_EQ(Strategy::Binary, table.strategy());
+    EXPECT_TRUE(table.fell_back());
+    expect_matches_reference(table, values, keys);
+  }
+}
+
+TEST(TestSwitchTable, StrategyBySize)
+{
+  const std::initializer_list<std::pair<size_type, Strategy>> sizes{
+    {switch_table_detail::linear_max, Strategy::Linear},
+    {switch_table_detail::linear_max + 1, Strategy::Binary},
+    {switch_table_detail::binary_max, Strategy::Binary},
+    {switch_table_detail::binary_max + 1, Strategy::PerfectHash}};
+
+  for(const auto & [num_keys, strategy] : sizes)
+  {
+    const auto keys{large_keys(num_keys)};
+    const auto values{make_switch(keys)};
+    const SwitchTable table{values};
+
+    EXPECT_EQ(strategy, table.strategy()) << num_keys << " keys";
+    EXPECT_FALSE(table.fell_back());
+    expect_matches_reference(table, values, keys);
+  }
+}
+
+TEST(TestSwitchValueAction, MissTakesDefault)
+{
+  const auto keys{large_keys(50)};
+  const SwitchValueAction action{std::string{"default"}, make_switch(keys)};
+
+  MetricData metric_data{};
+
+  metric_data.Value("key_7");
+  EXPECT_TRUE(action.Apply(metric_data, ValueType::String));
+  EXPECT_EQ("value_7", metric_data.Value());
+
+  metric_data.Value("key_50");
+  EXPECT_FALSE(action.Apply(metric_data, ValueType::String));
+  EXPECT_EQ("default", metric_data.Value());
+
+  metric_data.Value("");
+  EXPECT_FALSE(action.Apply(metric_data, ValueType::String));
+  EXPECT_EQ("default", metric_data.Value());
+}
+
+} // namespace yafiyogi::yy_values::tests
@@ -0,0 +1,263 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_value_action_range.hpp"
+#include "yy_values_metric.hpp"
+#include "yy_values_metric_data.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+// Celsius readings scaled to Fahrenheit, then banded.
+constexpr std::string_view g_values_yaml =
+  "- value: \"temperature\"\n"
+  "  handlers:\n"
+  "    - handler_id: \"handler\"\n"
+  "      property: \"temp\"\n"
+  "      value_actions:\n"
+  "        - action: convert\n"
+  "          from: celsius\n"
+  "          to: fahrenheit\n"
+  "        - action: range\n"
+  "          default: \"unknown\"\n"
+  "          ranges:\n"
+  "            - below: 32\n"
+  "              value: \"freezing\"\n"
+  "            - below: 70\n"
+  "              value: \"mild\"\n"
+  "            - value: \"hot\"\n";
+
+RangeValueAction make_action(bool p_catch_all)
+{
+  RangeValueAction::Ranges ranges{};
+
+  // Out of order; the action sorts them.
+  ranges.emplace_back(RangeValueAction::Range{20.0, "mild"});
+  ranges.emplace_back(RangeValueAction::Range{10.0, "cold"});
+  ranges.emplace_back(RangeValueAction::Range{30.0, "warm"});
+  if(p_catch_all)
+  {
+    ranges.emplace_back(RangeValueAction::Range{std::numeric_limits<double>::infinity(), "hot"});
+  }
+
+  return RangeValueAction{std::string{"default"}, std::move(ranges)};
+}
+
+// Returns the output, and in p_matched whether a range matched.
+std::string apply(const RangeValueAction & p_action,
+                  std::string_view p_value,
+                  bool & p_matched,
+                  ValueType p_value_type = ValueType::Float)
+{
+  MetricData metric_data{};
+  metric_data.Value(p_value);
+  p_matched = p_action.Apply(metric_data, p_value_type);
+
+  return std::string{metric_data.Value()};
+}
+
+} // anonymous namespace
+
+TEST(TestRangeValueAction, ValueOnBound)
+{
+  const auto action{make_action(false)};
+  bool matched = false;
+
+  // Bounds are exclusive upper bounds, so a value on a bound takes
+  // the next range.
+  EXPECT_EQ("mild", apply(action, "10", matched));
+  EXPECT_TRUE(matched);
+  EXPECT_EQ("warm", apply(action, "20", matched));
+  EXPECT_TRUE(matched);
+  EXPECT_EQ("cold", apply(action, "9.999", matched));
+  EXPECT_TRUE(matched);
+  EXPECT_EQ("mild", apply(action, "19", matched, ValueType::Int));
+  EXPECT_TRUE(matched);
+}
+
+TEST(TestRangeValueAction, BelowFirstBound)
+{
+  const auto action{make_action(false)};
+  bool matched = false;
+
+  EXPECT_EQ("cold", apply(action, "-40", matched));
+  EXPECT_TRUE(matched);
+  EXPECT_EQ("cold", apply(action, "-inf", matched));
+  EXPECT_TRUE(matched);
+}
+
+TEST(TestRangeValueAction, AboveLastBound)
+{
+  const auto action{make_action(false)};
+  bool matched = false;
+
+  EXPECT_EQ("default", apply(action, "30", matched));
+  EXPECT_FALSE(matched);
+  EXPECT_EQ("default", apply(action, "1e300", matched));
+  EXPECT_FALSE(matched);
+}
+
+TEST(TestRangeValueAction, NaN)
+{
+  for(bool catch_all : {false, true})
+  {
+    const auto action{make_action(catch_all)};
+    bool matched = true;
+
+    EXPECT_EQ("default", apply(action, "nan", matched));
+    EXPECT_FALSE(matched);
+  }
+}
+
+TEST(TestRangeValueAction, Infinity)
+{
+  bool matched = true;
+
+  const auto no_catch_all{make_action(false)};
+  EXPECT_EQ("default", apply(no_catch_all, "inf", matched));
+  EXPECT_FALSE(matched);
+
+  const auto catch_all{make_action(true)};
+  EXPECT_EQ("hot", apply(catch_all, "inf", matched));
+  EXPECT_TRUE(matched);
+  EXPECT_EQ("hot", apply(catch_all, "30", matched));
+  EXPECT_TRUE(matched);
+  EXPECT_EQ("hot", apply(catch_all, "1e308", matched));
+  EXPECT_TRUE(matched);
+  EXPECT_EQ("warm", apply(catch_all, "29", matched));
+  EXPECT_TRUE(matched);
+}
+
+TEST(TestRangeValueAction, UnparseableTakesDefault)
+{
+  const auto action{make_action(true)};
+  bool matched = true;
+
+  EXPECT_EQ("default", apply(action, "warm", matched));
+  EXPECT_FALSE(matched);
+  EXPECT_EQ("default", apply(action, "", matched));
+  EXPECT_FALSE(matched);
+
+  // Int values do not take a fraction.
+  EXPECT_EQ("default", apply(action, "12.5", matched, ValueType::Int));
+  EXPECT_FALSE(matched);
+
+  // String values are parsed as Float.
+  EXPECT_EQ("mild", apply(action, "12.5", matched, ValueType::String));
+  EXPECT_TRUE(matched);
+}
+
+TEST(TestRangeValueAction, NoRanges)
+{
+  const RangeValueAction action{std::string{"default"}, RangeValueAction::Ranges{}};
+  bool matched = true;
+
+  EXPECT_EQ("default", apply(action, "1", matched));
+  EXPECT_FALSE(matched);
+}
+
+TEST(TestRangeValueAction, UsesParsedBinary)
+{
+  const auto action{make_action(false)};
+
+  // An earlier action's result is taken from Binary(), not re-parsed.
+  MetricData metric_data{};
+  metric_data.Value("not parsed again");
+  metric_data.Type(ValueType::Float);
+  metric_data.Binary(25.0);
+  metric_data.Status(ValueStatus::Ok);
+
+  EXPECT_TRUE(action.Apply(metric_data, ValueType::Float));
+  EXPECT_EQ("warm", metric_data.Value());
+}
+
+TEST(TestRangeValueAction, OutputIsFinalString)
+{
+  const auto action{make_action(false)};
+
+  for(std::string_view value : {"15", "99", "warm"})
+  {
+    MetricData metric_data{};
+    metric_data.Value(value);
+    metric_data.Type(ValueType::Float);
+
+    std::ignore = action.Apply(metric_data, ValueType::Float);
+    EXPECT_EQ(ValueType::String, metric_data.Type()) << value;
+    EXPECT_EQ(ValueStatus::Ok, metric_data.Status()) << value;
+  }
+}
+
+TEST(TestRangeValueAction, MetricEventStatus)
+{
+  spdlog::set_level(spdlog::level::warn);
+
+  auto metrics{configure_values(YAML::Load(std::string{g_values_yaml}))};
+  ASSERT_EQ(1, metrics.size());
+
+  auto [ignore_key, handler_metrics] = metrics[0];
+  ASSERT_EQ(1, handler_metrics.size());
+  const auto & metric = *handler_metrics[0];
+  auto context{metric.CreateContext()};
+
+  struct Case
+  {
+      std::string_view value{};
+      ValueType value_type = ValueType::Unknown;
+      std::string_view output{};
+  };
+
+  for(const auto & [value, value_type, output] : {Case{"-5", ValueType::Float, "freezing"},
+                                                  Case{"20.5", ValueType::Float, "mild"},
+                                                  Case{"30", ValueType::Int, "hot"},
+                                                  Case{"warm", ValueType::Float, "unknown"}})
+  {
+    MetricDataVector metric_data{};
+
+    EXPECT_TRUE(metric.Event(context,
+                             MetricEvent{value, "sensor", {}, timestamp_type{}, value_type},
+                             MetricDataVectorPtr{&metric_data}));
+
+    ASSERT_EQ(1, metric_data.size()) << value;
+    EXPECT_EQ(output, metric_data[0].Value()) << value;
+    EXPECT_EQ(ValueType::String, metric_data[0].Type()) << value;
+    EXPECT_EQ(ValueStatus::Ok, metric_data[0].Status()) << value;
+  }
+}
+
+} // namespace yafiyogi::yy_values::tests
@@ -0,0 +1,348 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_value_action_transform.hpp"
+#include "yy_values_metric_data.hpp"
+#include "yy_values_metric_spec.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+struct UnitValue
+{
+    std::string_view unit{};
+    double value = 0.0;
+};
+
+// Each row holds the same amount in every unit of one quantity.
+const std::vector<std::vector<UnitValue>> g_equivalents{
+  {{"kelvin", 373.15}, {"celsius", 100.0}, {"fahrenheit", 212.0}},
+  {{"mm", 1609344.0}, {"cm", 160934.4}, {"m", 1609.344}, {"km", 1.609344},
+   {"in", 63360.0}, {"ft", 5280.0}, {"mi", 1.0}},
+  {{"m/s", 0.44704}, {"km/h", 1.609344}, {"mph", 1.0}, {"knot", 0.44704 * 3600.0 / 1852.0}},
+  {{"pa", 6894.757293168}, {"hpa", 68.94757293168}, {"kpa", 6.894757293168},
+   {"bar", 0.06894757293168}, {"psi", 1.0}},
+  {{"j", 3600000.0}, {"kj", 3600.0}, {"wh", 1000.0}, {"kwh", 1.0}},
+  {{"w", 1000.0}, {"kw", 1.0}}};
+
+TransformStep affine(double p_a,
+                     double p_b)
+{
+  return TransformStep{TransformOp::Affine, p_a, p_b};
+}
+
+TransformValueAction make_action(const TransformSteps & p_steps,
+                                 std::string p_default_value = std::string{})
+{
+  return TransformValueAction{std::move(p_default_value), TransformSteps{p_steps}};
+}
+
+double apply(const TransformValueAction & p_action,
+             double p_value)
+{
+  const auto input{std::to_string(p_value)};
+  MetricData metric_data{};
+  metric_data.Value(input);
+  EXPECT_TRUE(p_action.Apply(metric_data, ValueType::Float));
+
+  return std::get<double>(metric_data.Binary());
+}
+
+// Runs each step as its own action, passing the formatted value on.
+double apply_separately(const TransformSteps & p_steps,
+                        double p_value)
+{
+  std::string value{std::to_string(p_value)};
+  MetricData metric_data{};
+
+  for(const auto & step : p_steps)
+  {
+    TransformSteps single{};
+    single.emplace_back(step);
+    const auto action{make_action(single)};
+
+    metric_data.Value(value);
+    EXPECT_TRUE(action.Apply(metric_data, ValueType::Float));
+    value = std::string{metric_data.Value()};
+  }
+
+  return std::get<double>(metric_data.Binary());
+}
+
+ValueActionSpec transform_spec(TransformStep p_step,
+                               std::string_view p_default_value)
+{
+  TransformSteps steps{};
+  steps.emplace_back(p_step);
+
+  return ValueActionSpec{ValueOpCode::Transform,
+                         std::string{p_default_value},
+                         ValueActionSpec::Mappings{},
+                         RangeValueAction::Ranges{},
+                         std::move(steps)};
+}
+
+std::string apply_all(const ValueActions & p_actions,
+                      std::string_view p_value)
+{
+  MetricData metric_data{};
+  metric_data.Value(p_value);
+
+  for(const auto & action : p_actions)
+  {
+    std::ignore = action->Apply(metric_data, ValueType::Float);
+  }
+
+  return std::string{metric_data.Value()};
+}
+
+void expect_close(double p_expected,
+                  double p_actual)
+{
+  EXPECT_NEAR(p_expected, p_actual, 1e-9 * std::max(1.0, std::abs(p_expected)));
+}
+
+} // anonymous namespace
+
+TEST(TestTransformValueAction, AffineStepOrder)
+{
+  TransformSteps offset_then_scale{};
+  offset_then_scale.emplace_back(affine(1.0, 10.0));
+  offset_then_scale.emplace_back(affine(2.0, 0.0));
+
+  const auto fused_offset_then_scale{make_action(offset_then_scale)};
+  EXPECT_EQ(1, fused_offset_then_scale.Steps().size());
+  EXPECT_EQ(30.0, apply(fused_offset_then_scale, 5.0));
+  EXPECT_EQ(30.0, apply_separately(offset_then_scale, 5.0));
+
+  TransformSteps scale_then_offset{};
+  scale_then_offset.emplace_back(affine(2.0, 0.0));
+  scale_then_offset.emplace_back(affine(1.0, 10.0));
+
+  const auto fused_scale_then_offset{make_action(scale_then_offset)};
+  EXPECT_EQ(1, fused_scale_then_offset.Steps().size());
+  EXPECT_EQ(20.0, apply(fused_scale_then_offset, 5.0));
+  EXPECT_EQ(20.0, apply_separately(scale_then_offset, 5.0));
+}
+
+TEST(TestTransformValueAction, FusedMatchesSeparate)
+{
+  TransformSteps steps{};
+  steps.emplace_back(affine(1.0, -32.0));
+  steps.emplace_back(affine(5.0 / 9.0, 0.0));
+  steps.emplace_back(TransformStep{TransformOp::Clamp, -20.0, 50.0});
+  steps.emplace_back(affine(1.0, 273.15));
+  steps.emplace_back(affine(0.5, 0.0));
+  steps.emplace_back(affine(3.0, -7.013));
+  steps.emplace_back(TransformStep{TransformOp::Round, 100.0, 0.0});
+  steps.emplace_back(unit_conversion("celsius", "fahrenheit").value());
+
+  const auto action{make_action(steps)};
+
+  // Clamp and round split the affine runs.
+  EXPECT_EQ(5, action.Steps().size());
+
+  for(double value : {-459.67, -40.0, 0.0, 32.0, 70.5, 98.6, 212.0, 1.0e6})
+  {
+    SCOPED_TRACE(value);
+    expect_close(apply_separately(steps, value), apply(action, value));
+  }
+}
+
+TEST(TestTransformValueAction, UnitConversions)
+{
+  for(const auto & row : g_equivalents)
+  {
+    for(const auto & from : row)
+    {
+      for(const auto & to : row)
+      {
+        SCOPED_TRACE(std::string{from.unit} + " -> " + std::string{to.unit});
+
+        const auto step{unit_conversion(from.unit, to.unit)};
+        ASSERT_TRUE(step.has_value());
+        EXPECT_EQ(TransformOp::Affine, step->op);
+        expect_close(to.value, from.value * step->a + step->b);
+      }
+    }
+  }
+}
+
+TEST(TestTransformValueAction, UnitConversionRejects)
+{
+  EXPECT_FALSE(unit_conversion("celsius", "m").has_value());
+  EXPECT_FALSE(unit_conversion("kwh", "kw").has_value());
+  EXPECT_FALSE(unit_conversion("celsius", "rankine").has_value());
+  EXPECT_FALSE(unit_conversion("furlong", "furlong").has_value());
+}
+
+TEST(TestTransformValueAction, UnparseableTakesDefault)
+{
+  TransformSteps steps{};
+  steps.emplace_back(affine(2.0, 1.0));
+
+  MetricData metric_data{};
+
+  const auto with_default{make_action(steps, "n/a")};
+  metric_data.Value("warm");
+  EXPECT_FALSE(with_default.Apply(metric_data, ValueType::Float));
+  EXPECT_EQ("n/a", metric_data.Value());
+
+  // Without a default the value is left unchanged.
+  const auto without_default{make_action(steps)};
+  metric_data.Value("warm");
+  EXPECT_FALSE(without_default.Apply(metric_data, ValueType::Float));
+  EXPECT_EQ("warm", metric_data.Value());
+}
+
+TEST(TestTransformValueAction, UsesParsedBinary)
+{
+  TransformSteps steps{};
+  steps.emplace_back(affine(2.0, 1.0));
+  const auto action{make_action(steps)};
+
+  // An earlier action's result is taken from Binary(), not re-parsed.
+  MetricData metric_data{};
+  metric_data.Value("not parsed again");
+  metric_data.Type(ValueType::Int);
+  metric_data.Binary(int64_t{20});
+  metric_data.Status(ValueStatus::Ok);
+
+  EXPECT_TRUE(action.Apply(metric_data, ValueType::Int));
+  EXPECT_EQ("41", metric_data.Value());
+  EXPECT_EQ(ValueType::Float, metric_data.Type());
+  EXPECT_EQ(ValueStatus::Ok, metric_data.Status());
+
+  // A value that failed to parse is not parsed again.
+  metric_data.Value("20");
+  metric_data.Status(ValueStatus::Invalid);
+  EXPECT_FALSE(action.Apply(metric_data, ValueType::Float));
+}
+
+TEST(TestTransformValueAction, ParsesAsFloat)
+{
+  TransformSteps steps{};
+  steps.emplace_back(affine(2.0, 0.0));
+  const auto action{make_action(steps, "n/a")};
+
+  for(auto value_type : {ValueType::Int, ValueType::UInt, ValueType::Float, ValueType::String})
+  {
+    MetricData metric_data{};
+    metric_data.Value("21.5");
+    metric_data.Type(value_type);
+
+    EXPECT_TRUE(action.Apply(metric_data, value_type));
+    EXPECT_EQ("43", metric_data.Value());
+    EXPECT_EQ(ValueType::Float, metric_data.Type());
+    EXPECT_EQ(43.0, std::get<double>(metric_data.Binary()));
+  }
+}
+
+TEST(TestTransformValueAction, FusedDefaultsMatchSeparate)
+{
+  struct Chain
+  {
+      ValueActionSpecs specs{};
+      size_type num_actions = 0;
+  };
+
+  yy_quad::simple_vector<Chain> chains{};
+
+  // A numeric default is transformed by the steps after it.
+  chains.emplace_back();
+  chains.back().specs.emplace_back(transform_spec(affine(2.0, 0.0), "0"));
+  chains.back().specs.emplace_back(transform_spec(affine(1.0, 273.15), ""));
+  chains.back().num_actions = 2;
+
+  // Both defaults given.
+  chains.emplace_back();
+  chains.back().specs.emplace_back(transform_spec(affine(1.0, 273.15), "1"));
+  chains.back().specs.emplace_back(transform_spec(affine(2.0, 0.0), "n/a"));
+  chains.back().num_actions = 2;
+
+  // Steps without a default fuse with the next default.
+  chains.emplace_back();
+  chains.back().specs.emplace_back(transform_spec(affine(2.0, 0.0), ""));
+  chains.back().specs.emplace_back(transform_spec(affine(1.0, -3.0), "-40"));
+  chains.back().specs.emplace_back(transform_spec(TransformStep{TransformOp::Round, 10.0, 0.0}, ""));
+  chains.back().specs.emplace_back(transform_spec(affine(1.0, 1.0), "n/a"));
+  chains.back().num_actions = 2;
+
+  // A default that doesn't parse is left by later steps.
+  chains.emplace_back();
+  chains.back().specs.emplace_back(transform_spec(affine(2.0, 0.0), "n/a"));
+  chains.back().specs.emplace_back(transform_spec(affine(1.0, 1.0), ""));
+  chains.back().num_actions = 2;
+
+  for(size_type chain_idx = 0; chain_idx < chains.size(); ++chain_idx)
+  {
+    SCOPED_TRACE(chain_idx);
+    const auto & specs = chains[chain_idx].specs;
+
+    const auto fused{create_value_actions(specs)};
+    EXPECT_EQ(chains[chain_idx].num_actions, fused.size());
+
+    ValueActions separate{};
+    for(const auto & spec : specs)
+    {
+      ValueActionSpecs single{};
+      single.emplace_back(spec);
+      for(auto & action : create_value_actions(single))
+      {
+        separate.emplace_back(std::move(action));
+      }
+    }
+    ASSERT_EQ(specs.size(), separate.size());
+
+    for(std::string_view input : {"warm", "", "5", "-40.5"})
+    {
+      SCOPED_TRACE(input);
+      EXPECT_EQ(apply_all(separate, input), apply_all(fused, input));
+    }
+  }
+
+  // The first chain's default is offset like any other value.
+  const auto actions{create_value_actions(chains[0].specs)};
+  EXPECT_EQ("273.15", apply_all(actions, "warm"));
+}
+
+} // namespace yafiyogi::yy_values::tests
@@ -0,0 +1,116 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+
+#include <cstdint>
+#include <string_view>
+#include <variant>
+
+#include "gtest/gtest.h"
+
+#include "yy_value_parse.hpp"
+
+namespace yafiyogi::yy_values::tests {
+
+namespace {
+
+ValueStatus parse(std::string_view p_value,
+                  ValueType p_value_type)
+{
+  MetricData::binary_type binary{};
+
+  return parse_value(p_value, p_value_type, binary);
+}
+
+} // anonymous namespace
+
+TEST(TestValueParse, Int)
+{
+  MetricData::binary_type binary{};
+
+  EXPECT_EQ(ValueStatus::Ok, parse_value("42", ValueType::Int, binary));
+  EXPECT_EQ(42, std::get<int64_t>(binary));
+  EXPECT_EQ(ValueStatus::Ok, parse_value("+42", ValueType::Int, binary));
+  EXPECT_EQ(42, std::get<int64_t>(binary));
+  EXPECT_EQ(ValueStatus::Ok, parse_value(" -42 ", ValueType::Int, binary));
+  EXPECT_EQ(-42, std::get<int64_t>(binary));
+}
+
+TEST(TestValueParse, Float)
+{
+  MetricData::binary_type binary{};
+
+  EXPECT_EQ(ValueStatus::Ok, parse_value("+21.5", ValueType::Float, binary));
+  EXPECT_EQ(21.5, std::get<double>(binary));
+  EXPECT_EQ(ValueStatus::Ok, parse_value("-1e3", ValueType::Float, binary));
+  EXPECT_EQ(-1000.0, std::get<double>(binary));
+}
+
+TEST(TestValueParse, SignErrors)
+{
+  for(auto value_type : {ValueType::Int, ValueType::UInt, ValueType::Float})
+  {
+    EXPECT_EQ(ValueStatus::Invalid, parse("", value_type));
+    EXPECT_EQ(ValueStatus::Invalid, parse("+", value_type));
+    EXPECT_EQ(ValueStatus::Invalid, parse("-", value_type));
+    EXPECT_EQ(ValueStatus::Invalid, parse("+-5", value_type));
+    EXPECT_EQ(ValueStatus::Invalid, parse("++5", value_type));
+    EXPECT_EQ(ValueStatus::Invalid, parse("-+5", value_type));
+    EXPECT_EQ(ValueStatus::Invalid, parse("5x", value_type));
+  }
+
+  EXPECT_EQ(ValueStatus::Invalid, parse("-5", ValueType::UInt));
+}
+
+TEST(TestValueParse, OutOfRange)
+{
+  EXPECT_EQ(ValueStatus::OutOfRange, parse("9223372036854775808", ValueType::Int));
+  EXPECT_EQ(ValueStatus::OutOfRange, parse("-9223372036854775809", ValueType::Int));
+  EXPECT_EQ(ValueStatus::OutOfRange, parse("+18446744073709551616", ValueType::UInt));
+  EXPECT_EQ(ValueStatus::OutOfRange, parse("1e400", ValueType::Float));
+
+  EXPECT_EQ(ValueStatus::Ok, parse("9223372036854775807", ValueType::Int));
+  EXPECT_EQ(ValueStatus::Ok, parse("18446744073709551615", ValueType::UInt));
+}
+
+TEST(TestValueParse, Bool)
+{
+  MetricData::binary_type binary{};
+
+  EXPECT_EQ(ValueStatus::Ok, parse_value("ON", ValueType::Bool, binary));
+  EXPECT_TRUE(std::get<bool>(binary));
+  EXPECT_EQ(ValueStatus::Ok, parse_value("no", ValueType::Bool, binary));
+  EXPECT_FALSE(std::get<bool>(binary));
+  EXPECT_EQ(ValueStatus::Invalid, parse("maybe", ValueType::Bool));
+  EXPECT_EQ(ValueStatus::Invalid, parse("+1", ValueType::Bool));
+}
+
+TEST(TestValueParse, StringIsUnparsed)
+{
+  EXPECT_EQ(ValueStatus::Unparsed, parse("42", ValueType::String));
+}
+
+} // namespace yafiyogi::yy_values::tests
@@ -40,6 +40,7 @@
 #include "yy_configure_label_actions.hpp"
 #include "yy_label_action.hpp"
 #include "yy_replacement_format.hpp"
+#include "yy_values_metric_spec.hpp"
 
 namespace yafiyogi::yy_values {
 
@@ -116,8 +117,8 @@ void configure_label_action_replace_format(std::string_view replacement_format,
 
 } // namespace
 
-void configure_label_action_replace_path_format(const YAML::Node & yaml_format,
-                                                ReplacementTopicsConfig & p_topics_config)
+void configure_replace_path_spec(const YAML::Node & yaml_format,
+                                 ReplacePathSpecs & p_specs)
 {
   if(yaml_format)
   {
@@ -138,25 +139,43 @@ void configure_label_action_replace_path_format(const YAML::Node & yaml_format,
     {
       spdlog::debug("       replace: [{}] with [{}]."sv, replacement_pattern, replacement_format);
       configure_label_action_replace_format(replacement_format,
-                                            [replacement_pattern, &p_topics_config](ReplaceFormat & format)
+                                            [replacement_pattern, &p_specs](ReplaceFormat & format)
                                             {
-                                              std::ignore = p_topics_config.add(replacement_pattern,
-                                                                                std::move(format));
+                                              p_specs.emplace_back(ReplacePathSpec{std::string{replacement_pattern},
+                                                                                   std::move(format)});
                                             });
     }
   }
 }
 
-ReplacementTopics configure_label_action_replace_path(const YAML::Node & yaml_replace)
+ReplacePathSpecs configure_replace_path_specs(const YAML::Node & yaml_replace)
 {
-  ReplacementTopicsConfig topics_config;
+  ReplacePathSpecs specs{};
 
   for(const auto & yaml_format : yaml_replace)
   {
-    configure_label_action_replace_path_format(yaml_format, topics_config);
+    configure_replace_path_spec(yaml_format, specs);
   }
 
-  return topics_config.create_automaton();
+  return specs;
+}
+
+void configure_label_action_replace_path_format(const YAML::Node & yaml_format,
+                                                ReplacementTopicsConfig & p_topics_config)
+{
+  ReplacePathSpecs specs{};
+  configure_replace_path_spec(yaml_format, specs);
+
+  for(auto & spec : specs)
+  {
+    std::ignore = p_topics_config.add(spec.pattern,
+                                      std::move(spec.format));
+  }
+}
+
+ReplacementTopics configure_label_action_replace_path(const YAML::Node & yaml_replace)
+{
+  return create_replacement_topics(configure_replace_path_specs(yaml_replace));
 }
 
 } // namespace yafiyogi::yy_values
@@ -29,9 +29,14 @@
 #include "yy_tp_util/yaml_fwd.h"
 
 #include "yy_label_action_replace_path.hpp"
+#include "yy_values_metric_spec.hpp"
 
 namespace yafiyogi::yy_values {
 
+void configure_replace_path_spec(const YAML::Node & yaml_format,
+                                 ReplacePathSpecs & p_specs);
+ReplacePathSpecs configure_replace_path_specs(const YAML::Node & yaml_replace);
+
 void configure_label_action_replace_path_format(const YAML::Node & yaml_format,
                                                 ReplacementTopicsConfig & p_topics_config);
 ReplacementTopics configure_label_action_replace_path(const YAML::Node & yaml_replace);
@@ -24,8 +24,17 @@
 
 */
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
 
 #include "spdlog/spdlog.h"
 
@@ -42,8 +51,11 @@
 #include "yy_configure_values.hpp"
 #include "yy_label_action.hpp"
 #include "yy_label_action_replace_path.hpp"
+#include "yy_values_hash.hpp"
+#include "yy_values_label_id.hpp"
 #include "yy_values_metric.hpp"
 #include "yy_values_metric_labels.hpp"
+#include "yy_values_metric_spec.hpp"
 
 #include "yy_label_action_copy.hpp"
 #include "yy_label_action_drop.hpp"
@@ -51,7 +63,9 @@
 #include "yy_label_action_replace_path.hpp"
 
 #include "yy_value_action_keep.hpp"
+#include "yy_value_action_range.hpp"
 #include "yy_value_action_switch.hpp"
+#include "yy_value_action_transform.hpp"
 
 namespace yafiyogi::yy_values {
 
@@ -68,17 +82,86 @@ constexpr const auto g_label_action_types =
                                                            {KeepLabelAction::action_name, LabelActionType::Keep},
                                                            {ReplacePathLabelAction::action_name, LabelActionType::ReplacePath}});
 
-enum class ValueActionType {Keep, Switch};
+enum class ValueActionType {Keep, Switch, Range, Scale, Offset, Clamp, Round, Convert};
 
 constexpr const auto g_value_action_types =
   yy_data::make_lookup<std::string_view, ValueActionType>({{KeepValueAction::action_name, ValueActionType::Keep},
-                                                           {SwitchValueAction::action_name, ValueActionType::Switch}});
+                                                           {SwitchValueAction::action_name, ValueActionType::Switch},
+                                                           {RangeValueAction::action_name, ValueActionType::Range},
+                                                           {TransformValueAction::scale_name, ValueActionType::Scale},
+                                                           {TransformValueAction::offset_name, ValueActionType::Offset},
+                                                           {TransformValueAction::clamp_name, ValueActionType::Clamp},
+                                                           {TransformValueAction::round_name, ValueActionType::Round},
+                                                           {TransformValueAction::convert_name, ValueActionType::Convert}});
+
+constexpr const auto g_dedup_modes =
+  yy_data::make_lookup<std::string_view, DedupMode>(DedupMode::Off,
+                                                    {{"off"sv, DedupMode::Off},
+                                                     {"suppress"sv, DedupMode::Suppress},
+                                                     {"mark"sv, DedupMode::Mark}});
+
+constexpr const auto g_rate_modes =
+  yy_data::make_lookup<std::string_view, RateMode>(RateMode::Off,
+                                                   {{"off"sv, RateMode::Off},
+                                                    {"delta"sv, RateMode::Delta},
+                                                    {"rate"sv, RateMode::Rate}});
+
+// Structural hash of a YAML subtree. Map keys are hashed in document
+// order, so reordering keys counts as a change.
+uint64_t yaml_fingerprint(const YAML::Node & yaml_node)
+{
+  uint64_t fingerprint = hash_mix(static_cast<uint64_t>(yaml_node.Type()));
+
+  switch(yaml_node.Type())
+  {
+    case YAML::NodeType::Scalar:
+      fingerprint = hash_combine(fingerprint, hash_string(yaml_node.Scalar()));
+      break;
+
+    case YAML::NodeType::Sequence:
+      for(const auto & yaml_item : yaml_node)
+      {
+        fingerprint = hash_combine(fingerprint, yaml_fingerprint(yaml_item));
+      }
+      break;
+
+    case YAML::NodeType::Map:
+      for(const auto & yaml_item : yaml_node)
+      {
+        fingerprint = hash_combine(fingerprint, yaml_fingerprint(yaml_item.first));
+        fingerprint = hash_combine(fingerprint, yaml_fingerprint(yaml_item.second));
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  return fingerprint;
+}
+
+std::optional<std::string> configure_default_value(const YAML::Node & yaml_value_action)
+{
+  std::optional<std::string> default_value{std::nullopt};
+
+  if(auto & yaml_default = yaml_value_action["default"sv];
+     yaml_default)
+  {
+    default_value = yy_util::yaml_get_optional_value<std::string>(yaml_default);
+    if(default_value.has_value())
+    {
+      spdlog::info("         - default: [{}]"sv, default_value.value());
+    }
+  }
+
+  return default_value;
+}
 
 } // anonymous namespace
 
-LabelActions configure_label_actions(const YAML::Node & yaml_label_actions)
+LabelActionSpecs configure_label_action_specs(const YAML::Node & yaml_label_actions)
 {
-  LabelActions label_actions;
+  LabelActionSpecs label_actions;
 
   if(yaml_label_actions)
   {
@@ -87,7 +170,6 @@ LabelActions configure_label_actions(const YAML::Node & yaml_label_actions)
     for(const auto & yaml_label_action : yaml_label_actions)
     {
       auto action_name{yy_util::to_lower(yy_util::trim(yy_util::yaml_get_value<std::string_view>(yaml_label_action["action"sv])))};
-      LabelActionPtr action;
 
       spdlog::info("       - label action [{}]."sv, action_name);
       spdlog::trace("          [line {}]."sv, yaml_label_action.Mark().line + 1);
@@ -100,8 +182,10 @@ LabelActions configure_label_actions(const YAML::Node & yaml_label_actions)
           if(!source.empty()
              || !target.empty())
           {
-            action = yy_util::static_unique_cast<LabelAction>(std::make_unique<CopyLabelAction>(std::string{source},
-                                                                                                std::string{target}));
+            label_actions.emplace_back(LabelActionSpec{LabelOpCode::Copy,
+                                                       std::string{source},
+                                                       std::string{target},
+                                                       ReplacePathSpecs{}});
           }
         }
         break;
@@ -111,7 +195,10 @@ LabelActions configure_label_actions(const YAML::Node & yaml_label_actions)
           std::string_view target{yy_util::trim(yy_util::yaml_get_value<std::string_view>(yaml_label_action["target"sv]))};
           if(!target.empty())
           {
-            action = yy_util::static_unique_cast<LabelAction>(std::make_unique<DropLabelAction>(std::string{target}));
+            label_actions.emplace_back(LabelActionSpec{LabelOpCode::Drop,
+                                                       std::string{},
+                                                       std::string{target},
+                                                       ReplacePathSpecs{}});
           }
         }
         break;
@@ -121,7 +208,10 @@ LabelActions configure_label_actions(const YAML::Node & yaml_label_actions)
           std::string_view target{yy_util::trim(yy_util::yaml_get_value<std::string_view>(yaml_label_action["target"sv]))};
           if(!target.empty())
           {
-            action = yy_util::static_unique_cast<LabelAction>(std::make_unique<KeepLabelAction>(std::string{target}));
+            label_actions.emplace_back(LabelActionSpec{LabelOpCode::Keep,
+                                                       std::string{},
+                                                       std::string{target},
+                                                       ReplacePathSpecs{}});
           }
         }
         break;
@@ -132,12 +222,10 @@ LabelActions configure_label_actions(const YAML::Node & yaml_label_actions)
 
           if(!target.empty())
           {
-            auto create_topics = [&yaml_label_action]() {
-              return configure_label_action_replace_path(yaml_label_action["replace"sv]);
-            };
-
-            action = yy_util::static_unique_cast<LabelAction>(std::make_unique<ReplacePathLabelAction>(std::string{target},
-                                                                                                       create_topics()));
+            label_actions.emplace_back(LabelActionSpec{LabelOpCode::ReplacePath,
+                                                       std::string{},
+                                                       std::string{target},
+                                                       configure_replace_path_specs(yaml_label_action["replace"sv])});
           }
         }
         break;
@@ -147,20 +235,15 @@ LabelActions configure_label_actions(const YAML::Node & yaml_label_actions)
           spdlog::trace("  [line {}]."sv, yaml_label_action.Mark().line + 1);
           break;
       }
-
-      if(action)
-      {
-        label_actions.emplace_back(std::move(action));
-      }
     }
   }
 
   return label_actions;
 }
 
-ValueActions configure_value_actions(const YAML::Node & yaml_value_actions)
+ValueActionSpecs configure_value_action_specs(const YAML::Node & yaml_value_actions)
 {
-  ValueActions value_actions;
+  ValueActionSpecs value_actions;
   if(yaml_value_actions)
   {
     value_actions.reserve(yaml_value_actions.size());
@@ -168,39 +251,36 @@ ValueActions configure_value_actions(const YAML::Node & yaml_value_actions)
     for(const auto & yaml_value_action : yaml_value_actions)
     {
       auto action_name{yy_util::to_lower(yy_util::trim(yy_util::yaml_get_value<std::string_view>(yaml_value_action["action"sv])))};
-      ValueActionPtr action;
 
       spdlog::info("       - value action [{}]."sv, action_name);
       spdlog::trace("          [line {}]."sv, yaml_value_action.Mark().line + 1);
+
+      // Each numeric step is its own spec; consecutive steps are
+      // fused into one action when built. A step's optional default
+      // replaces values it can't parse.
+      auto add_transform = [&value_actions, &yaml_value_action](TransformStep p_step) {
+        TransformSteps steps{};
+        steps.emplace_back(p_step);
+        value_actions.emplace_back(ValueActionSpec{ValueOpCode::Transform,
+                                                   configure_default_value(yaml_value_action).value_or(std::string{}),
+                                                   ValueActionSpec::Mappings{},
+                                                   RangeValueAction::Ranges{},
+                                                   std::move(steps)});
+      };
+
       switch(g_value_action_types.lookup(action_name, ValueActionType::Keep))
       {
         case ValueActionType::Keep:
           // Don't add as it does nothing.
-          // action = yy_util::static_unique_cast<ValueAction>(std::make_unique<KeepValueAction>());
           break;
 
         case ValueActionType::Switch:
         {
-          std::optional<std::string> default_value{std::nullopt};
+          auto default_value{configure_default_value(yaml_value_action)};
 
-          if(auto & yaml_default = yaml_value_action["default"sv];
-             yaml_default)
-          {
-            default_value = yy_util::yaml_get_optional_value<std::string>(yaml_default);
-            if(default_value.has_value())
-            {
-              spdlog::info("         - default: [{}]"sv, default_value.value());
-            }
-          }
-
-          SwitchValueAction::Switch switch_values;
+          ValueActionSpec::Mappings mappings;
           auto & yaml_mappings = yaml_value_action["mappings"sv];
-
-          if(auto num_cases = yaml_mappings.size();
-             num_cases > 1)
-          {
-            switch_values.reserve(num_cases - 1);
-          }
+          mappings.reserve(yaml_mappings.size());
 
           for(auto & yaml_case : yaml_mappings)
           {
@@ -214,24 +294,133 @@ ValueActions configure_value_actions(const YAML::Node & yaml_value_actions)
                 auto output{yy_util::yaml_get_value<std::string_view>(yaml_output)};
 
                 spdlog::info("         - input: [{}] output: [{}]", input, output);
-                switch_values.emplace(std::string{input},
+                mappings.emplace_back(std::string{input},
                                       std::string{output});
               }
             }
           }
 
           if(default_value.has_value()
-             && !switch_values.empty())
+             && !mappings.empty())
           {
-            action = yy_util::static_unique_cast<ValueAction>(std::make_unique<SwitchValueAction>(std::move(default_value.value()),
-                                                                                                  std::move(switch_values)));
+            value_actions.emplace_back(ValueActionSpec{ValueOpCode::Switch,
+                                                       std::move(default_value.value()),
+                                                       std::move(mappings)});
           }
           else
           {
             spdlog::warn(" Value action [{}] not created default {}present, values {}present.",
                          action_name,
                          (default_value.has_value() ? ""sv : "not "sv),
-                         (switch_values.empty() ? "not "sv : ""sv) );
+                         (mappings.empty() ? "not "sv : ""sv) );
+          }
+        }
+        break;
+
+        case ValueActionType::Range:
+        {
+          auto default_value{configure_default_value(yaml_value_action)};
+
+          // A range without 'below' catches everything above the
+          // previous bound.
+          RangeValueAction::Ranges ranges;
+          auto & yaml_ranges = yaml_value_action["ranges"sv];
+          ranges.reserve(yaml_ranges.size());
+
+          for(auto & yaml_range : yaml_ranges)
+          {
+            if(auto output{yy_util::yaml_get_optional_value<std::string>(yaml_range["value"sv])};
+               output.has_value())
+            {
+              const auto & yaml_below = yaml_range["below"sv];
+              const double below = yaml_below
+                                   ? yy_util::yaml_get_value<double>(yaml_below)
+                                   : std::numeric_limits<double>::infinity();
+
+              spdlog::info("         - below: [{}] output: [{}]", below, output.value());
+              ranges.emplace_back(RangeValueAction::Range{below, std::move(output.value())});
+            }
+            else
+            {
+              spdlog::warn(" Range without 'value' ignored."sv);
+              spdlog::trace("  [line {}]."sv, yaml_range.Mark().line + 1);
+            }
+          }
+
+          if(default_value.has_value()
+             && !ranges.empty())
+          {
+            value_actions.emplace_back(ValueActionSpec{ValueOpCode::Range,
+                                                       std::move(default_value.value()),
+                                                       ValueActionSpec::Mappings{},
+                                                       std::move(ranges)});
+          }
+          else
+          {
+            spdlog::warn(" Value action [{}] not created default {}present, ranges {}present.",
+                         action_name,
+                         (default_value.has_value() ? ""sv : "not "sv),
+                         (ranges.empty() ? "not "sv : ""sv) );
+          }
+        }
+        break;
+
+        case ValueActionType::Scale:
+        {
+          const auto factor = yy_util::yaml_get_value(yaml_value_action["factor"sv], 1.0);
+          spdlog::info("         - factor: [{}]"sv, factor);
+          add_transform(TransformStep{TransformOp::Affine, factor, 0.0});
+        }
+        break;
+
+        case ValueActionType::Offset:
+        {
+          const auto offset = yy_util::yaml_get_value(yaml_value_action["value"sv], 0.0);
+          spdlog::info("         - value: [{}]"sv, offset);
+          add_transform(TransformStep{TransformOp::Affine, 1.0, offset});
+        }
+        break;
+
+        case ValueActionType::Clamp:
+        {
+          auto min = yy_util::yaml_get_value(yaml_value_action["min"sv], -std::numeric_limits<double>::infinity());
+          auto max = yy_util::yaml_get_value(yaml_value_action["max"sv], std::numeric_limits<double>::infinity());
+          if(min > max)
+          {
+            spdlog::warn(" Clamp min [{}] above max [{}], swapped."sv, min, max);
+            std::swap(min, max);
+          }
+
+          spdlog::info("         - min: [{}] max: [{}]"sv, min, max);
+          add_transform(TransformStep{TransformOp::Clamp, min, max});
+        }
+        break;
+
+        case ValueActionType::Round:
+        {
+          const auto digits = std::clamp(yy_util::yaml_get_value(yaml_value_action["digits"sv], 0), -15, 15);
+          spdlog::info("         - digits: [{}]"sv, digits);
+          add_transform(TransformStep{TransformOp::Round, std::pow(10.0, digits), 0.0});
+        }
+        break;
+
+        case ValueActionType::Convert:
+        {
+          auto from{yy_util::to_lower(yy_util::trim(yy_util::yaml_get_value<std::string_view>(yaml_value_action["from"sv])))};
+          auto to{yy_util::to_lower(yy_util::trim(yy_util::yaml_get_value<std::string_view>(yaml_value_action["to"sv])))};
+
+          if(auto step = unit_conversion(from, to);
+             step.has_value())
+          {
+            spdlog::info("         - from: [{}] to: [{}]"sv, from, to);
+            add_transform(step.value());
+          }
+          else
+          {
+            spdlog::warn(" Value action [{}] not created, can't convert [{}] to [{}]."sv,
+                         action_name,
+                         from,
+                         to);
           }
         }
         break;
@@ -241,20 +430,15 @@ ValueActions configure_value_actions(const YAML::Node & yaml_value_actions)
           spdlog::trace("  [line {}]."sv, yaml_value_action.Mark().line + 1);
           break;
       }
-
-      if(action)
-      {
-        value_actions.emplace_back(std::move(action));
-      }
     }
   }
 
   return value_actions;
 }
 
-LabelActions configure_property_actions(const YAML::Node & yaml_handler)
+ReplacePathSpecs configure_location_specs(const YAML::Node & yaml_handler)
 {
-  LabelActions l_property_actions{};
+  ReplacePathSpecs location{};
 
   if(yaml_handler)
   {
@@ -262,38 +446,132 @@ LabelActions configure_property_actions(const YAML::Node & yaml_handler)
     if(const auto & yaml_location = yaml_handler[yy_values::g_label_location];
        yaml_location)
     {
-      auto create_location = [&yaml_location]() {
-        ReplacementTopicsConfig topics_config{};
-
-
-        if(yy_util::yaml_is_scalar(yaml_location))
+      if(yy_util::yaml_is_scalar(yaml_location))
+      {
+        spdlog::info("     - location:"sv);
+        configure_replace_path_spec(yaml_location, location);
+      }
+      else if(yy_util::yaml_is_sequence(yaml_location))
+      {
+        spdlog::info("    - location:"sv);
+        for(const auto & yaml_loc : yaml_location)
         {
-          spdlog::info("     - location:"sv);
-          configure_label_action_replace_path_format(yaml_location, topics_config);
-        }
-        else if(yy_util::yaml_is_sequence(yaml_location))
-        {
-          spdlog::info("    - location:"sv);
-          for(const auto & yaml_loc : yaml_location)
-          {
-            configure_label_action_replace_path_format(yaml_loc, topics_config);
-          }
+          configure_replace_path_spec(yaml_loc, location);
         }
+      }
+    }
+  }
 
-        return topics_config.create_automaton();
-      };
+  return location;
+}
+
+LabelActions configure_label_actions(const YAML::Node & yaml_label_actions)
+{
+  return create_label_actions(configure_label_action_specs(yaml_label_actions));
+}
+
+ValueActions configure_value_actions(const YAML::Node & yaml_value_actions)
+{
+  return create_value_actions(configure_value_action_specs(yaml_value_actions));
+}
+
+LabelActions configure_property_actions(const YAML::Node & yaml_handler)
+{
+  return create_property_actions(configure_location_specs(yaml_handler));
+}
+
+DedupConfig configure_dedup(const YAML::Node & yaml_dedup)
+{
+  DedupConfig dedup{};
 
-      l_property_actions.emplace_back(yy_util::static_unique_cast<LabelAction>(std::make_unique<ReplacePathLabelAction>(std::string{yy_values::g_label_location},
-                                                                                                                        create_location())));
+  if(yaml_dedup)
+  {
+    const bool is_scalar = yy_util::yaml_is_scalar(yaml_dedup);
+    auto mode{yy_util::to_lower(yy_util::trim(is_scalar
+                                              ? yy_util::yaml_get_value<std::string_view>(yaml_dedup)
+                                              : yy_util::yaml_get_value(yaml_dedup["mode"sv], "suppress"sv)))};
+
+    dedup.mode = g_dedup_modes.lookup(mode);
+    if((DedupMode::Off == dedup.mode) && ("off"sv != mode))
+    {
+      spdlog::warn("     Unrecognized dedup mode [{}], dedup is off."sv, mode);
+    }
+
+    if(!is_scalar)
+    {
+      dedup.heartbeat = std::chrono::seconds{yy_util::yaml_get_value(yaml_dedup["heartbeat"sv], int64_t{0})};
+      dedup.expiry = std::chrono::seconds{yy_util::yaml_get_value(yaml_dedup["expiry"sv],
+                                                                  std::chrono::duration_cast<std::chrono::seconds>(dedup.expiry).count())};
+    }
+
+    spdlog::info("     - dedup [{}] heartbeat [{}s] expiry [{}s]."sv,
+                 mode,
+                 std::chrono::duration_cast<std::chrono::seconds>(dedup.heartbeat).count(),
+                 std::chrono::duration_cast<std::chrono::seconds>(dedup.expiry).count());
+    spdlog::trace("        [line {}]."sv, yaml_dedup.Mark().line + 1);
+  }
+
+  return dedup;
+}
+
+RateConfig configure_rate(const YAML::Node & yaml_rate)
+{
+  RateConfig rate{};
+
+  if(yaml_rate)
+  {
+    const bool is_scalar = yy_util::yaml_is_scalar(yaml_rate);
+    auto mode{yy_util::to_lower(yy_util::trim(is_scalar
+                                              ? yy_util::yaml_get_value<std::string_view>(yaml_rate)
+                                              : yy_util::yaml_get_value(yaml_rate["mode"sv], "rate"sv)))};
+
+    rate.mode = g_rate_modes.lookup(mode);
+    if((RateMode::Off == rate.mode) && ("off"sv != mode))
+    {
+      spdlog::warn("     Unrecognized rate mode [{}], rate is off."sv, mode);
+    }
+
+    if(!is_scalar)
+    {
+      rate.series = yy_util::yaml_get_value(yaml_rate["series"sv], rate.series);
+      rate.expiry = std::chrono::seconds{yy_util::yaml_get_value(yaml_rate["expiry"sv],
+                                                                 std::chrono::duration_cast<std::chrono::seconds>(rate.expiry).count())};
     }
+
+    spdlog::info("     - rate [{}] series [{}] expiry [{}s]."sv,
+                 mode,
+                 rate.series,
+                 std::chrono::duration_cast<std::chrono::seconds>(rate.expiry).count());
+    spdlog::trace("        [line {}]."sv, yaml_rate.Mark().line + 1);
+  }
+
+  return rate;
+}
+
+size_type configure_cache_capacity(const YAML::Node & yaml_capacity)
+{
+  size_type capacity = replace_path_cache_detail::default_capacity;
+
+  if(yaml_capacity)
+  {
+    capacity = yy_util::yaml_get_value(yaml_capacity, capacity);
+    if(0 == capacity)
+    {
+      spdlog::warn("     replace_path_cache must be greater than zero, using [{}]."sv,
+                   replace_path_cache_detail::default_capacity);
+      capacity = replace_path_cache_detail::default_capacity;
+    }
+
+    spdlog::info("     - replace_path_cache [{}]."sv, capacity);
+    spdlog::trace("        [line {}]."sv, yaml_capacity.Mark().line + 1);
   }
 
-  return l_property_actions;
+  return capacity;
 }
 
-MetricsMap configure_values(const YAML::Node & yaml_values)
+MetricSpecs configure_metric_specs(const YAML::Node & yaml_values)
 {
-  MetricsMap metrics{};
+  MetricSpecs specs{};
 
   if(yaml_values)
   {
@@ -328,38 +606,26 @@ MetricsMap configure_values(const YAML::Node & yaml_values)
             spdlog::info("     - value [{}]."sv, property_name.value());
             spdlog::trace("        [line {}]."sv, yaml_property.Mark().line + 1);
 
-            auto create_label_actions = [&yaml_handler]() {
-              spdlog::trace("        configure label actions [line {}]."sv, yaml_handler.Mark().line + 1);
-              return configure_label_actions(yaml_handler["label_actions"sv]);
-            };
-
-            auto create_value_actions = [&yaml_handler]() {
-              spdlog::trace("        configure value actions [line {}]."sv, yaml_handler.Mark().line + 1);
-              return configure_value_actions(yaml_handler["value_actions"sv]);
-            };
-
-            auto create_property_actions = [&yaml_handler]() {
-              spdlog::trace("        configure property actions [line {}]."sv, yaml_handler.Mark().line + 1);
-              return configure_property_actions(yaml_handler);
-            };
-
-            auto metric{std::make_shared<Metric>(MetricId{value_id, std::string{}},
-                                                 std::string{property_name.value()},
-                                                 create_label_actions(),
-                                                 create_value_actions(),
-                                                 create_property_actions())};
-
-            spdlog::info("     - add metric [{}] to handler [{}] property [{}]."sv,
-                         metric->Id().Name(),
-                         handler_id,
-                         metric->Property());
-
-            auto [metrics_pos, ignore_found] = metrics.emplace(std::string{handler_id},
-                                                               Metrics{});
-
-            auto [ignore_key, handler_metrics] = metrics[metrics_pos];
-
-            handler_metrics.emplace_back(std::move(metric));
+            spdlog::trace("        configure label actions [line {}]."sv, yaml_handler.Mark().line + 1);
+            auto label_actions{configure_label_action_specs(yaml_handler["label_actions"sv])};
+
+            spdlog::trace("        configure value actions [line {}]."sv, yaml_handler.Mark().line + 1);
+            auto value_actions{configure_value_action_specs(yaml_handler["value_actions"sv])};
+
+            spdlog::trace("        configure property actions [line {}]."sv, yaml_handler.Mark().line + 1);
+            auto location{configure_location_specs(yaml_handler)};
+
+            specs.emplace_back(MetricSpec{std::string{handler_id},
+                                          std::string{value_id},
+                                          std::string{property_name.value()},
+                                          std::move(location),
+                                          std::move(label_actions),
+                                          std::move(value_actions),
+                                          configure_dedup(yaml_handler["dedup"sv]),
+                                          configure_rate(yaml_handler["rate"sv]),
+                                          configure_cache_capacity(yaml_handler["replace_path_cache"sv]),
+                                          hash_combine(hash_string(value_id),
+                                                       yaml_fingerprint(yaml_handler))});
           }
         }
         else
@@ -371,8 +637,14 @@ MetricsMap configure_values(const YAML::Node & yaml_values)
     }
   }
 
-  return metrics;
+  return specs;
 }
 
+MetricsMap configure_values(const YAML::Node & yaml_values,
+                            const MetricsMap * p_previous)
+{
+  return create_metrics(configure_metric_specs(yaml_values),
+                        p_previous);
+}
 
 } // namespace yafiyogi::yy_values
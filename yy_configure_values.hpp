@@ -29,12 +29,26 @@
 #include "yy_tp_util/yaml_fwd.h"
 
 #include "yy_values_metric.hpp"
+#include "yy_values_metric_spec.hpp"
 
 namespace yafiyogi::yy_values {
 
+LabelActionSpecs configure_label_action_specs(const YAML::Node & yaml_label_actions);
+ValueActionSpecs configure_value_action_specs(const YAML::Node & yaml_value_actions);
+ReplacePathSpecs configure_location_specs(const YAML::Node & yaml_handler);
+MetricSpecs configure_metric_specs(const YAML::Node & yaml_metrics);
+
 LabelActions configure_label_actions(const YAML::Node & yaml_label_actions);
 ValueActions configure_value_actions(const YAML::Node & yaml_value_actions);
 LabelActions configure_property_actions(const YAML::Node & yaml_value);
-MetricsMap configure_values(const YAML::Node & yaml_metrics);
+DedupConfig configure_dedup(const YAML::Node & yaml_dedup);
+RateConfig configure_rate(const YAML::Node & yaml_rate);
+size_type configure_cache_capacity(const YAML::Node & yaml_capacity);
+
+// With p_previous, a handler whose YAML is unchanged shares its
+// existing Metric instead of building a new one, so reload time scales
+// with the size of the change.
+MetricsMap configure_values(const YAML::Node & yaml_metrics,
+                            const MetricsMap * p_previous = nullptr);
 
 } // namespace yafiyogi::yy_values
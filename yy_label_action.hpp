@@ -47,11 +47,14 @@ class LabelAction
 
     virtual void Apply(const Labels & /* p_labels_in */,
                        const yy_mqtt::TopicLevelsView & p_levels_in,
-                       Labels & /* p_labels_out */) noexcept = 0;
+                       Labels & /* p_labels_out */) const noexcept = 0;
 
     virtual void Apply(const Labels & /* p_labels_in */,
                        const yy_mqtt::TopicLevelsView & p_levels_in,
-                       std::string & /* p_label_out */) noexcept = 0;
+                       std::string & /* p_label_out */) const noexcept = 0;
+
+    // Append the equivalent instruction(s) to p_program.
+    virtual void Compile(LabelActionProgram & /* p_program */) const = 0;
 
     virtual std::string_view Name() const noexcept = 0;
 };
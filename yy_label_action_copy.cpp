@@ -26,21 +26,22 @@
 
 #include <memory>
 
+#include "yy_label_action_program.hpp"
 #include "yy_values_labels.hpp"
 #include "yy_label_action_copy.hpp"
 
 namespace yafiyogi::yy_values {
 
-CopyLabelAction::CopyLabelAction(std::string && p_label_source,
-                                 std::string && p_label_target) noexcept:
-  m_label_source(std::move(p_label_source)),
-  m_label_target(std::move(p_label_target))
+CopyLabelAction::CopyLabelAction(LabelId p_label_source,
+                                 LabelId p_label_target) noexcept:
+  m_label_source(p_label_source),
+  m_label_target(p_label_target)
 {
 }
 
 void CopyLabelAction::Apply(const Labels & p_labels_in,
                             const yy_mqtt::TopicLevelsView & /* p_levels_in */,
-                            Labels & p_labels_out) noexcept
+                            Labels & p_labels_out) const noexcept
 {
   auto do_copy_label = [this, &p_labels_out](auto label_value, auto) {
     p_labels_out.set_label(m_label_target, *label_value);
@@ -51,7 +52,7 @@ void CopyLabelAction::Apply(const Labels & p_labels_in,
 
 void CopyLabelAction::Apply(const Labels & p_labels_in,
                             const yy_mqtt::TopicLevelsView & /* p_levels_in */,
-                            std::string & p_label_out) noexcept
+                            std::string & p_label_out) const noexcept
 {
   auto do_copy_label = [this, &p_label_out](auto label_value, auto) {
     p_label_out = *label_value;
@@ -60,5 +61,9 @@ void CopyLabelAction::Apply(const Labels & p_labels_in,
   std::ignore = p_labels_in.get_label(do_copy_label, m_label_source);
 }
 
+void CopyLabelAction::Compile(LabelActionProgram & p_program) const
+{
+  p_program.add(LabelOpCode::Copy, m_label_source, m_label_target);
+}
 
 } // namespace yafiyogi::yy_values
@@ -33,6 +33,7 @@
 #include "yy_cpp/yy_vector.h"
 
 #include "yy_label_action.hpp"
+#include "yy_values_label_id.hpp"
 
 namespace yafiyogi::yy_values {
 
@@ -40,8 +41,8 @@ class CopyLabelAction:
       public LabelAction
 {
   public:
-    explicit CopyLabelAction(std::string && p_label_source,
-                             std::string && p_label_target) noexcept;
+    explicit CopyLabelAction(LabelId p_label_source,
+                             LabelId p_label_target) noexcept;
     constexpr CopyLabelAction() noexcept = default;
     constexpr CopyLabelAction(const CopyLabelAction &) noexcept = default;
     constexpr CopyLabelAction(CopyLabelAction &&) noexcept = default;
@@ -51,11 +52,13 @@ class CopyLabelAction:
 
     void Apply(const Labels & p_labels_in,
                const yy_mqtt::TopicLevelsView & p_levels_in,
-               Labels & p_labels_out) noexcept override;
+               Labels & p_labels_out) const noexcept override;
 
     void Apply(const Labels & p_labels_in,
                const yy_mqtt::TopicLevelsView & p_levels_in,
-               std::string & p_label_out) noexcept override;
+               std::string & p_label_out) const noexcept override;
+
+    void Compile(LabelActionProgram & p_program) const override;
 
     static constexpr const std::string_view action_name{"copy"};
     constexpr std::string_view Name() const noexcept override
@@ -64,8 +67,8 @@ class CopyLabelAction:
     }
 
   private:
-    std::string m_label_source{};
-    std::string m_label_target{};
+    LabelId m_label_source{};
+    LabelId m_label_target{};
 };
 
 } // namespace yafiyogi::yy_values
@@ -27,28 +27,34 @@
 #include <string>
 #include <memory>
 
+#include "yy_label_action_program.hpp"
 #include "yy_values_labels.hpp"
 #include "yy_label_action_drop.hpp"
 
 namespace yafiyogi::yy_values {
 
-DropLabelAction::DropLabelAction(std::string && p_label_name) noexcept:
-  m_label_name(std::move(p_label_name))
+DropLabelAction::DropLabelAction(LabelId p_label_name) noexcept:
+  m_label_name(p_label_name)
 {
 }
 
 void DropLabelAction::Apply(const Labels & /* p_labels_in */,
                             const yy_mqtt::TopicLevelsView & /* p_levels_in */,
-                            Labels & p_labels_out) noexcept
+                            Labels & p_labels_out) const noexcept
 {
   p_labels_out.erase(m_label_name);
 }
 
 void DropLabelAction::Apply(const Labels & /* p_labels_in */,
                             const yy_mqtt::TopicLevelsView & /* p_levels_in */,
-                            std::string & /* p_label_out */) noexcept
+                            std::string & /* p_label_out */) const noexcept
 {
   // Do nothing.
 }
 
+void DropLabelAction::Compile(LabelActionProgram & p_program) const
+{
+  p_program.add(LabelOpCode::Drop, LabelId{}, m_label_name);
+}
+
 } // namespace yafiyogi::yy_values
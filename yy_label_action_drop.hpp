@@ -29,6 +29,7 @@
 #include "yy_cpp/yy_vector.h"
 
 #include "yy_label_action.hpp"
+#include "yy_values_label_id.hpp"
 
 namespace yafiyogi::yy_values {
 
@@ -36,7 +37,7 @@ class DropLabelAction:
       public LabelAction
 {
   public:
-    explicit DropLabelAction(std::string && p_label_name) noexcept;
+    explicit DropLabelAction(LabelId p_label_name) noexcept;
     constexpr DropLabelAction() noexcept = default;
     constexpr DropLabelAction(const DropLabelAction &) noexcept = default;
     constexpr DropLabelAction(DropLabelAction &&) noexcept = default;
@@ -46,11 +47,13 @@ class DropLabelAction:
 
     void Apply(const Labels & p_labels_in,
                const yy_mqtt::TopicLevelsView & p_levels_in,
-               Labels & p_labels_out) noexcept override;
+               Labels & p_labels_out) const noexcept override;
 
     void Apply(const Labels & p_labels_in,
                const yy_mqtt::TopicLevelsView & p_levels_in,
-               std::string & p_label_out) noexcept override;
+               std::string & p_label_out) const noexcept override;
+
+    void Compile(LabelActionProgram & p_program) const override;
 
     static constexpr const std::string_view action_name{"drop"};
     constexpr std::string_view Name() const noexcept override
@@ -59,7 +62,7 @@ class DropLabelAction:
     }
 
   private:
-    std::string m_label_name{};
+    LabelId m_label_name{};
 };
 
 } // namespace yafiyogi::yy_values
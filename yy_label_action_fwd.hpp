@@ -33,6 +33,7 @@
 namespace yafiyogi::yy_values {
 
 class LabelAction;
+class LabelActionProgram;
 using LabelActionPtr = std::unique_ptr<LabelAction>;
 using LabelActions = yy_quad::simple_vector<LabelActionPtr>;
 
@@ -27,19 +27,20 @@
 #include <string>
 #include <memory>
 
+#include "yy_label_action_program.hpp"
 #include "yy_values_labels.hpp"
 #include "yy_label_action_keep.hpp"
 
 namespace yafiyogi::yy_values {
 
-KeepLabelAction::KeepLabelAction(std::string && p_label) noexcept:
-  m_label(std::move(p_label))
+KeepLabelAction::KeepLabelAction(LabelId p_label) noexcept:
+  m_label(p_label)
 {
 }
 
 void KeepLabelAction::Apply(const Labels & p_labels_in,
                             const yy_mqtt::TopicLevelsView & /* p_levels_in */,
-                            Labels & p_labels_out) noexcept
+                            Labels & p_labels_out) const noexcept
 {
   auto do_keep_label = [this, &p_labels_out](auto label_value, auto) {
     p_labels_out.set_label(m_label, *label_value);
@@ -50,7 +51,7 @@ void KeepLabelAction::Apply(const Labels & p_labels_in,
 
 void KeepLabelAction::Apply(const Labels & p_labels_in,
                             const yy_mqtt::TopicLevelsView & /* p_levels_in */,
-                            std::string & p_label_out) noexcept
+                            std::string & p_label_out) const noexcept
 {
   auto do_keep_label = [&p_label_out](auto label_value, auto) {
     p_label_out = *label_value;
@@ -59,4 +60,9 @@ void KeepLabelAction::Apply(const Labels & p_labels_in,
   std::ignore = p_labels_in.get_label(do_keep_label, m_label);
 }
 
+void KeepLabelAction::Compile(LabelActionProgram & p_program) const
+{
+  p_program.add(LabelOpCode::Keep, m_label, m_label);
+}
+
 } // namespace yafiyogi::yy_values
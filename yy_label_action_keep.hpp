@@ -29,6 +29,7 @@
 #include "yy_cpp/yy_vector.h"
 
 #include "yy_label_action.hpp"
+#include "yy_values_label_id.hpp"
 
 namespace yafiyogi::yy_values {
 
@@ -36,7 +37,7 @@ class KeepLabelAction:
       public LabelAction
 {
   public:
-    explicit KeepLabelAction(std::string && p_label) noexcept;
+    explicit KeepLabelAction(LabelId p_label) noexcept;
     constexpr KeepLabelAction() noexcept = default;
     constexpr KeepLabelAction(const KeepLabelAction &) noexcept = default;
     constexpr KeepLabelAction(KeepLabelAction &&) noexcept = default;
@@ -46,11 +47,13 @@ class KeepLabelAction:
 
     void Apply(const Labels & p_labels_in,
                const yy_mqtt::TopicLevelsView & p_levels_in,
-               Labels & p_labels_out) noexcept override;
+               Labels & p_labels_out) const noexcept override;
 
     void Apply(const Labels & p_labels_in,
                const yy_mqtt::TopicLevelsView & p_levels_in,
-               std::string & p_label_out) noexcept override;
+               std::string & p_label_out) const noexcept override;
+
+    void Compile(LabelActionProgram & p_program) const override;
 
     static constexpr const std::string_view action_name{"keep"};
     constexpr std::string_view Name() const noexcept override
@@ -59,7 +62,7 @@ class KeepLabelAction:
     }
 
   private:
-    std::string m_label{};
+    LabelId m_label{};
 };
 
 } // namespace yafiyogi::valuse
@@ -0,0 +1,204 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "yy_label_action.hpp"
+#include "yy_label_action_copy.hpp"
+#include "yy_label_action_drop.hpp"
+#include "yy_label_action_keep.hpp"
+#include "yy_values_labels.hpp"
+#include "yy_values_metric_labels.hpp"
+
+#include "yy_label_action_program.hpp"
+
+namespace yafiyogi::yy_values {
+namespace {
+
+constexpr std::string_view op_name(LabelOpCode p_op) noexcept
+{
+  switch(p_op)
+  {
+    case LabelOpCode::Copy:
+      return CopyLabelAction::action_name;
+
+    case LabelOpCode::Keep:
+      return KeepLabelAction::action_name;
+
+    case LabelOpCode::Drop:
+      return DropLabelAction::action_name;
+
+    case LabelOpCode::ReplacePath:
+      return ReplacePathLabelAction::action_name;
+  }
+
+  return std::string_view{};
+}
+
+} // anonymous namespace
+
+void LabelActionProgram::add(LabelOpCode p_op,
+                             LabelId p_source,
+                             LabelId p_target)
+{
+  m_instructions.emplace_back(Instruction{p_op, 0, p_source, p_target});
+}
+
+void LabelActionProgram::add_replace_path(LabelId p_target,
+                                          const ReplacementTopics & p_topics)
+{
+  auto topics_idx = static_cast<uint32_t>(m_replace_paths.size());
+
+  m_replace_paths.emplace_back(ReplacePath{p_target, p_topics});
+  m_instructions.emplace_back(Instruction{LabelOpCode::ReplacePath, topics_idx, LabelId{}, p_target});
+}
+
+ReplacePathCaches LabelActionProgram::create_caches(size_type p_capacity) const
+{
+  ReplacePathCaches caches{};
+
+  caches.reserve(m_replace_paths.size());
+  for(size_type idx = 0; idx < m_replace_paths.size(); ++idx)
+  {
+    caches.emplace_back(p_capacity);
+  }
+
+  return caches;
+}
+
+ActionStatsVector LabelActionProgram::create_stats() const
+{
+  if constexpr(g_stats_enabled)
+  {
+    return ActionStatsVector(m_instructions.size());
+  }
+
+  return ActionStatsVector{};
+}
+
+ActionSnapshots LabelActionProgram::snapshot_stats(const ActionStatsVector & p_stats) const
+{
+  ActionSnapshots snapshots{};
+
+  snapshots.reserve(m_instructions.size());
+  for(size_type idx = 0; idx < m_instructions.size(); ++idx)
+  {
+    const auto & instruction = m_instructions[idx];
+    ActionSnapshot snapshot{op_name(instruction.op), instruction.target};
+
+    if(idx < p_stats.size())
+    {
+      snapshot.calls = p_stats[idx].calls.value();
+      snapshot.misses = p_stats[idx].misses.value();
+    }
+
+    snapshots.emplace_back(snapshot);
+  }
+
+  return snapshots;
+}
+
+void LabelActionProgram::Apply(const Labels & p_labels_in,
+                               const yy_mqtt::TopicLevelsView & p_levels_in,
+                               Labels & p_labels_out,
+                               ReplacePathCaches & p_caches,
+                               ActionStatsVector & p_stats) const
+{
+  const bool has_stats = g_stats_enabled && (p_stats.size() == m_instructions.size());
+
+  for(size_type idx = 0; idx < m_instructions.size(); ++idx)
+  {
+    const auto & instruction = m_instructions[idx];
+
+    if(has_stats)
+    {
+      p_stats[idx].calls.inc();
+    }
+
+    switch(instruction.op)
+    {
+      case LabelOpCode::Copy:
+      case LabelOpCode::Keep:
+      {
+        auto do_copy_label = [&instruction, &p_labels_out](auto label_value, auto) {
+          p_labels_out.set_label(instruction.target, *label_value);
+        };
+
+        std::ignore = p_labels_in.get_label(do_copy_label, instruction.source);
+      }
+      break;
+
+      case LabelOpCode::Drop:
+        p_labels_out.erase(instruction.target);
+        break;
+
+      case LabelOpCode::ReplacePath:
+      {
+        // Find the format before writing, since p_labels_in may be
+        // p_labels_out and writing invalidates its topic view.
+        const auto & l_topics = m_replace_paths[instruction.topics_idx].topics;
+        const auto l_topic = p_labels_in.get_label(g_label_topic_id);
+
+        const ReplaceFormat * format = nullptr;
+        if(instruction.topics_idx < p_caches.size())
+        {
+          format = p_caches[instruction.topics_idx].find(l_topics, l_topic);
+        }
+        else if(auto payloads = l_topics.find(l_topic);
+                !payloads.empty())
+        {
+          format = &(*payloads[0]);
+        }
+
+        if(has_stats && (nullptr == format))
+        {
+          p_stats[idx].misses.inc();
+        }
+
+        p_labels_out.assign_label(instruction.target, [format, &p_levels_in](std::string & p_label_out) {
+          replace_path(format, p_levels_in, p_label_out);
+        });
+      }
+      break;
+    }
+  }
+}
+
+LabelActionProgram compile_label_actions(const LabelActions & p_label_actions)
+{
+  LabelActionProgram program{};
+
+  for(const auto & action : p_label_actions)
+  {
+    action->Compile(program);
+  }
+
+  return program;
+}
+
+} // namespace yafiyogi::yy_values
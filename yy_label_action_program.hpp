@@ -0,0 +1,140 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+#include "yy_mqtt/yy_mqtt_types.h"
+
+#include "yy_label_action_fwd.hpp"
+#include "yy_label_action_replace_path.hpp"
+#include "yy_replace_path_cache.hpp"
+#include "yy_replacement_topics.hpp"
+#include "yy_values_label_id.hpp"
+#include "yy_values_labels_fwd.hpp"
+#include "yy_values_stats.hpp"
+
+namespace yafiyogi::yy_values {
+
+enum class LabelOpCode:uint8_t {Copy, Keep, Drop, ReplacePath};
+
+// Flat equivalent of a LabelActions chain. Each action is lowered to
+// one instruction with interned operands and Apply() runs them in a
+// single loop without virtual calls.
+//
+// A program is immutable once built. Replace-path match caches are
+// supplied by the caller (see create_caches()) so one program can be
+// shared by several threads.
+class LabelActionProgram final
+{
+  public:
+    struct Instruction
+    {
+        LabelOpCode op = LabelOpCode::Keep;
+        uint32_t topics_idx = 0;
+        LabelId source{};
+        LabelId target{};
+    };
+
+    struct ReplacePath
+    {
+        LabelId target{};
+        ReplacementTopics topics{};
+    };
+
+    using Instructions = yy_quad::simple_vector<Instruction>;
+    using ReplacePaths = yy_quad::simple_vector<ReplacePath>;
+
+    constexpr LabelActionProgram() noexcept = default;
+    constexpr LabelActionProgram(const LabelActionProgram &) noexcept = default;
+    constexpr LabelActionProgram(LabelActionProgram &&) noexcept = default;
+
+    constexpr LabelActionProgram & operator=(const LabelActionProgram &) noexcept = default;
+    constexpr LabelActionProgram & operator=(LabelActionProgram &&) noexcept = default;
+
+    void add(LabelOpCode p_op,
+             LabelId p_source,
+             LabelId p_target);
+    void add_replace_path(LabelId p_target,
+                          const ReplacementTopics & p_topics);
+
+    void Apply(const Labels & p_labels_in,
+               const yy_mqtt::TopicLevelsView & p_levels_in,
+               Labels & p_labels_out,
+               ReplacePathCaches & p_caches,
+               ActionStatsVector & p_stats) const;
+
+    // One cache of p_capacity entries per replace-path instruction,
+    // for use with Apply().
+    [[nodiscard]]
+    ReplacePathCaches create_caches(size_type p_capacity = replace_path_cache_detail::default_capacity) const;
+
+    // One counter set per instruction, for use with Apply(). Empty
+    // when stats are compiled out.
+    [[nodiscard]]
+    ActionStatsVector create_stats() const;
+
+    [[nodiscard]]
+    ActionSnapshots snapshot_stats(const ActionStatsVector & p_stats) const;
+
+    [[nodiscard]]
+    constexpr size_type size() const noexcept
+    {
+      return m_instructions.size();
+    }
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept
+    {
+      return m_instructions.empty();
+    }
+
+    // Visitor is called with (LabelId target, const ReplacePathCache::Stats &)
+    // for each replace-path instruction.
+    template<typename Visitor>
+    void visit_cache_stats(const ReplacePathCaches & p_caches,
+                           Visitor && visitor) const
+    {
+      const size_type l_size = std::min(m_replace_paths.size(), p_caches.size());
+
+      for(size_type idx = 0; idx < l_size; ++idx)
+      {
+        visitor(m_replace_paths[idx].target, p_caches[idx].stats());
+      }
+    }
+
+  private:
+    Instructions m_instructions{};
+    ReplacePaths m_replace_paths{};
+};
+
+LabelActionProgram compile_label_actions(const LabelActions & p_label_actions);
+
+} // namespace yafiyogi::yy_values
@@ -28,6 +28,7 @@
 #include <string>
 
 #include "yy_label_action.hpp"
+#include "yy_label_action_program.hpp"
 #include "yy_values_labels.hpp"
 #include "yy_values_metric_labels.hpp"
 
@@ -37,43 +38,71 @@
 
 namespace yafiyogi::yy_values {
 
-ReplacePathLabelAction::ReplacePathLabelAction(std::string && p_label_name,
+void replace_path(const ReplaceFormat * p_format,
+                  const yy_mqtt::TopicLevelsView & p_levels_in,
+                  std::string & p_label_out) noexcept
+{
+  if(nullptr != p_format)
+  {
+    const auto & topic_format = *p_format;
+
+    auto format_fn = [&p_levels_in, &p_label_out](const auto & formatter) {
+      formatter(p_levels_in, p_label_out);
+    };
+
+    for(const auto & format_element : topic_format)
+    {
+      std::visit(format_fn,
+                 format_element);
+    }
+  }
+}
+
+ReplacePathLabelAction::ReplacePathLabelAction(LabelId p_label_name,
                                                ReplacementTopics && p_topics) noexcept:
-  m_label_name(std::move(p_label_name)),
+  m_label_name(p_label_name),
   m_topics(std::move(p_topics))
 {
 }
 
 void ReplacePathLabelAction::Apply(const Labels & p_labels_in,
                                    const yy_mqtt::TopicLevelsView & p_levels_in,
-                                   Labels & p_labels_out) noexcept
+                                   Labels & p_labels_out) const noexcept
 {
-  Apply(p_labels_in, p_levels_in, p_labels_out.set_label(m_label_name, std::string_view{}));
+  const ReplaceFormat * format = Find(p_labels_in);
+
+  p_labels_out.assign_label(m_label_name,
+                            [format, &p_levels_in](std::string & p_label_out) {
+    replace_path(format, p_levels_in, p_label_out);
+  });
 }
 
 void ReplacePathLabelAction::Apply(const Labels & p_labels_in,
                                    const yy_mqtt::TopicLevelsView & p_levels_in,
-                                   std::string & p_label_out) noexcept
+                                   std::string & p_label_out) const noexcept
 {
-  if(auto payloads = m_topics.find(p_labels_in.get_label(g_label_topic));
-     !payloads.empty())
+  if(const ReplaceFormat * format = Find(p_labels_in);
+     nullptr != format)
   {
-    const auto & topic_format = *payloads[0];
-
     p_label_out.clear();
-
-    auto format_fn = [&p_levels_in, &p_label_out](const auto & formatter) {
-      formatter(p_levels_in, p_label_out);
-    };
-
-    for(const auto & format_element : topic_format)
-    {
-      std::visit(format_fn,
-                 format_element);
-    }
+    replace_path(format, p_levels_in, p_label_out);
   }
 }
 
+const ReplaceFormat * ReplacePathLabelAction::Find(const Labels & p_labels_in) const noexcept
+{
+  if(auto payloads = m_topics.find(p_labels_in.get_label(g_label_topic_id));
+     !payloads.empty())
+  {
+    return &(*payloads[0]);
+  }
 
+  return nullptr;
+}
+
+void ReplacePathLabelAction::Compile(LabelActionProgram & p_program) const
+{
+  p_program.add_replace_path(m_label_name, m_topics);
+}
 
 } // namespace yafiyogi::yy_values
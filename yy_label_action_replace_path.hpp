@@ -26,21 +26,24 @@
 
 #pragma once
 
-#include "yy_mqtt/yy_mqtt_variant_state_topics.h"
-
 #include "yy_label_action.hpp"
+#include "yy_values_label_id.hpp"
 #include "yy_replacement_format.hpp"
+#include "yy_replacement_topics.hpp"
 
 namespace yafiyogi::yy_values {
 
-using ReplacementTopicsConfig = yy_mqtt::variant_state_topics<ReplaceFormat>;
-using ReplacementTopics = ReplacementTopicsConfig::automaton_type;
+// Appends p_levels_in formatted by p_format to p_label_out. Does
+// nothing if p_format is nullptr.
+void replace_path(const ReplaceFormat * p_format,
+                  const yy_mqtt::TopicLevelsView & p_levels_in,
+                  std::string & p_label_out) noexcept;
 
 class ReplacePathLabelAction:
       public LabelAction
 {
   public:
-    explicit ReplacePathLabelAction(std::string && p_label_name,
+    explicit ReplacePathLabelAction(LabelId p_label_name,
                                     ReplacementTopics && p_topics) noexcept;
     constexpr ReplacePathLabelAction() noexcept = default;
     constexpr ReplacePathLabelAction(const ReplacePathLabelAction &) noexcept = default;
@@ -51,11 +54,13 @@ class ReplacePathLabelAction:
 
     void Apply(const Labels & p_labels_in,
                const yy_mqtt::TopicLevelsView & p_levels_in,
-               Labels & p_labels_out) noexcept override;
+               Labels & p_labels_out) const noexcept override;
 
     void Apply(const Labels & p_labels_in,
                const yy_mqtt::TopicLevelsView & p_levels_in,
-               std::string & p_label_out) noexcept override;
+               std::string & p_label_out) const noexcept override;
+
+    void Compile(LabelActionProgram & p_program) const override;
 
     static constexpr const std::string_view action_name{"replace-path"};
     constexpr std::string_view Name() const noexcept override
@@ -64,7 +69,10 @@ class ReplacePathLabelAction:
     }
 
   private:
-    std::string m_label_name{};
+    [[nodiscard]]
+    const ReplaceFormat * Find(const Labels & p_labels_in) const noexcept;
+
+    LabelId m_label_name{};
     ReplacementTopics m_topics{};
 };
 
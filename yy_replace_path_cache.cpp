@@ -0,0 +1,123 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+#include "yy_replace_path_cache.hpp"
+
+namespace yafiyogi::yy_values {
+
+ReplacePathCache::ReplacePathCache(size_type p_capacity) noexcept:
+  m_capacity(std::bit_ceil(std::max(p_capacity, size_type{1})))
+{
+}
+
+ReplacePathCache::ReplacePathCache(const ReplacePathCache & p_other) noexcept:
+  m_capacity(p_other.m_capacity)
+{
+}
+
+ReplacePathCache::ReplacePathCache(ReplacePathCache && p_other) noexcept:
+  m_capacity(p_other.m_capacity)
+{
+  p_other.clear();
+}
+
+ReplacePathCache & ReplacePathCache::operator=(const ReplacePathCache & p_other) noexcept
+{
+  if(this != &p_other)
+  {
+    m_entries.clear();
+    m_capacity = p_other.m_capacity;
+    m_stats = Stats{};
+  }
+
+  return *this;
+}
+
+ReplacePathCache & ReplacePathCache::operator=(ReplacePathCache && p_other) noexcept
+{
+  if(this != &p_other)
+  {
+    m_entries.clear();
+    m_capacity = p_other.m_capacity;
+    m_stats = Stats{};
+    p_other.clear();
+  }
+
+  return *this;
+}
+
+const ReplaceFormat * ReplacePathCache::find(const ReplacementTopics & p_topics,
+                                             std::string_view p_topic) noexcept
+{
+  if(m_entries.empty())
+  {
+    m_entries.resize(m_capacity);
+  }
+
+  auto & entry = m_entries[std::hash<std::string_view>{}(p_topic) & (m_capacity - 1)];
+
+  if(entry.used
+     && (entry.topic == p_topic))
+  {
+    ++m_stats.hits;
+    return entry.format;
+  }
+
+  ++m_stats.misses;
+  if(entry.used)
+  {
+    ++m_stats.evictions;
+  }
+
+  const ReplaceFormat * format = nullptr;
+  if(auto payloads = p_topics.find(p_topic);
+     !payloads.empty())
+  {
+    format = &(*payloads[0]);
+  }
+
+  entry.topic.assign(p_topic);
+  entry.format = format;
+  entry.used = true;
+
+  return format;
+}
+
+void ReplacePathCache::clear() noexcept
+{
+  for(auto & entry : m_entries)
+  {
+    entry.used = false;
+    entry.format = nullptr;
+  }
+  m_stats = Stats{};
+}
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,102 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_replacement_format.hpp"
+#include "yy_replacement_topics.hpp"
+
+namespace yafiyogi::yy_values {
+namespace replace_path_cache_detail {
+
+inline constexpr size_type default_capacity = 256;
+
+} // namespace replace_path_cache_detail
+
+// Bounded, direct mapped cache of topic to matched ReplaceFormat.
+// Misses are cached too (as nullptr). Cached pointers refer into the
+// automaton passed to find(), so copies and moves start empty.
+class ReplacePathCache final
+{
+  public:
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+    explicit ReplacePathCache(size_type p_capacity) noexcept;
+    constexpr ReplacePathCache() noexcept = default;
+    ReplacePathCache(const ReplacePathCache & p_other) noexcept;
+    ReplacePathCache(ReplacePathCache && p_other) noexcept;
+
+    ReplacePathCache & operator=(const ReplacePathCache & p_other) noexcept;
+    ReplacePathCache & operator=(ReplacePathCache && p_other) noexcept;
+
+    [[nodiscard]]
+    const ReplaceFormat * find(const ReplacementTopics & p_topics,
+                               std::string_view p_topic) noexcept;
+
+    void clear() noexcept;
+
+    [[nodiscard]]
+    constexpr size_type capacity() const noexcept
+    {
+      return m_capacity;
+    }
+
+    [[nodiscard]]
+    constexpr const Stats & stats() const noexcept
+    {
+      return m_stats;
+    }
+
+  private:
+    struct Entry
+    {
+        std::string topic{};
+        const ReplaceFormat * format = nullptr;
+        bool used = false;
+    };
+
+    using Entries = yy_quad::simple_vector<Entry>;
+
+    Entries m_entries{};
+    size_type m_capacity = replace_path_cache_detail::default_capacity;
+    Stats m_stats{};
+};
+
+using ReplacePathCaches = yy_quad::simple_vector<ReplacePathCache>;
+
+} // namespace yafiyogi::yy_values
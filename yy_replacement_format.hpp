@@ -57,9 +57,16 @@ class FormatPrefix
     FormatPrefix & operator=(const FormatPrefix &) noexcept = default;
     FormatPrefix & operator=(FormatPrefix &&) noexcept = default;
 
+    bool operator==(const FormatPrefix &) const noexcept = default;
+
     void operator()(const yy_mqtt::TopicLevelsView & /* p_path */,
                     std::string & label_value) const noexcept;
 
+    const std::string & Prefix() const noexcept
+    {
+      return m_prefix;
+    }
+
   private:
     std::string m_prefix{};
 };
@@ -97,9 +104,21 @@ class FormatLevel
       return *this;
     }
 
+    bool operator==(const FormatLevel &) const noexcept = default;
+
     void operator()(const yy_mqtt::TopicLevelsView & p_path,
                     std::string & label_value) const noexcept;
 
+    const std::string & Prefix() const noexcept
+    {
+      return m_prefix;
+    }
+
+    size_type Index() const noexcept
+    {
+      return m_idx;
+    }
+
   private:
     std::string m_prefix{};
     size_type m_idx = 0;
@@ -44,8 +44,9 @@ class ValueAction
     constexpr ValueAction & operator=(const ValueAction &) noexcept = default;
     constexpr ValueAction & operator=(ValueAction &&) noexcept = default;
 
-    virtual void Apply(MetricData & p_metric_data,
-                       ValueType p_value_type) noexcept = 0;
+    // Returns false if the action fell back to a default value.
+    virtual bool Apply(MetricData & p_metric_data,
+                       ValueType p_value_type) const noexcept = 0;
     virtual std::string_view Name() const noexcept = 0;
 };
 
@@ -28,9 +28,10 @@
 
 namespace yafiyogi::yy_values {
 
-void KeepValueAction::Apply(MetricData & /* p_metric_data */,
-                            ValueType /* p_value_type */) noexcept
+bool KeepValueAction::Apply(MetricData & /* p_metric_data */,
+                            ValueType /* p_value_type */) const noexcept
 {
+  return true;
 }
 
 } // namespace yafiyogi::yy_values
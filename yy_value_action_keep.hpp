@@ -41,8 +41,8 @@ class KeepValueAction:
     constexpr KeepValueAction & operator=(const KeepValueAction &) noexcept = default;
     constexpr KeepValueAction & operator=(KeepValueAction &&) noexcept = default;
 
-    void Apply(MetricData & p_metric_data,
-               ValueType p_value_type) noexcept override;
+    bool Apply(MetricData & p_metric_data,
+               ValueType p_value_type) const noexcept override;
 
     static constexpr const std::string_view action_name{"keep"};
     std::string_view Name() const noexcept override
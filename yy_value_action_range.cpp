@@ -0,0 +1,122 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+#include "yy_value_parse.hpp"
+#include "yy_values_metric_data.hpp"
+
+#include "yy_value_action_range.hpp"
+
+namespace yafiyogi::yy_values {
+
+RangeValueAction::RangeValueAction(std::string && p_default_value,
+                                   Ranges && p_ranges):
+  m_default_value(std::move(p_default_value))
+{
+  std::stable_sort(p_ranges.begin(), p_ranges.end(), [](const Range & p_lhs, const Range & p_rhs) {
+    return p_lhs.below < p_rhs.below;
+  });
+
+  m_bounds.reserve(p_ranges.size());
+  m_outputs.reserve(p_ranges.size());
+
+  for(auto & range : p_ranges)
+  {
+    // Later duplicates of a bound could never match, and NaN bounds
+    // match nothing, so both are dropped.
+    if(!std::isnan(range.below)
+       && (m_bounds.empty() || (m_bounds.back() < range.below)))
+    {
+      m_bounds.emplace_back(range.below);
+      m_outputs.emplace_back(std::move(range.output));
+    }
+  }
+
+  m_catch_all = !m_bounds.empty()
+                && (std::numeric_limits<double>::infinity() == m_bounds.back());
+}
+
+// Branch free binary search: returns the number of bounds <= p_value,
+// which is the index of the matching range.
+size_type RangeValueAction::find(double p_value) const noexcept
+{
+  const double * base = m_bounds.data();
+  size_type num_bounds = m_bounds.size();
+
+  if(0 == num_bounds)
+  {
+    return 0;
+  }
+
+  while(num_bounds > 1)
+  {
+    const size_type half = num_bounds / 2;
+    base = (base[half] <= p_value) ? base + half : base;
+    num_bounds -= half;
+  }
+
+  return static_cast<size_type>(base - m_bounds.data()) + static_cast<size_type>(*base <= p_value);
+}
+
+bool RangeValueAction::Apply(MetricData & p_metric_data,
+                             ValueType p_value_type) const noexcept
+{
+  bool matched = false;
+  std::string_view output{m_default_value};
+
+  if(const auto input{numeric_value(p_metric_data, p_value_type)};
+     input.has_value())
+  {
+    const double value = input.value();
+
+    auto idx = find(value);
+    if(m_catch_all && (idx == m_outputs.size()))
+    {
+      // Only +inf itself is not below a +inf bound.
+      --idx;
+    }
+
+    if(!std::isnan(value) && (idx < m_outputs.size()))
+    {
+      output = m_outputs[idx];
+      matched = true;
+    }
+  }
+
+  // The output is a label, not a number to parse again.
+  p_metric_data.Value(output);
+  p_metric_data.Type(ValueType::String);
+  p_metric_data.Status(ValueStatus::Ok);
+
+  return matched;
+}
+
+} // namespace yafiyogi::yy_values
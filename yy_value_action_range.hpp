@@ -0,0 +1,94 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_value_action.hpp"
+
+namespace yafiyogi::yy_values {
+
+// Maps a numeric value to the output of the first range whose
+// exclusive upper bound lies above it. Binary() is used when an
+// earlier action has parsed the value; otherwise it is parsed
+// according to its ValueType, with String and Unknown parsed as Float.
+// The output, or default, is stored as a String with Status() Ok, so
+// it is not parsed again.
+// Values that fail to parse, are NaN, or lie at or above the last
+// bound take the default. A last bound of +inf is a catch-all, which
+// also matches +inf.
+class RangeValueAction:
+      public ValueAction
+{
+  public:
+    struct Range
+    {
+        double below = 0.0;
+        std::string output{};
+
+        bool operator==(const Range &) const noexcept = default;
+    };
+
+    using Ranges = yy_quad::simple_vector<Range>;
+
+    RangeValueAction(std::string && p_default_value,
+                     Ranges && p_ranges);
+
+    RangeValueAction() noexcept = default;
+    RangeValueAction(const RangeValueAction &) = default;
+    RangeValueAction(RangeValueAction &&) noexcept = default;
+
+    RangeValueAction & operator=(const RangeValueAction &) = default;
+    RangeValueAction & operator=(RangeValueAction &&) noexcept = default;
+
+    bool Apply(MetricData & p_metric_data,
+               ValueType p_value_type) const noexcept override;
+
+    static constexpr const std::string_view action_name{"range"};
+    std::string_view Name() const noexcept override
+    {
+      return action_name;
+    }
+
+  private:
+    using Bounds = yy_quad::simple_vector<double>;
+    using Outputs = yy_quad::simple_vector<std::string>;
+
+    [[nodiscard]]
+    size_type find(double p_value) const noexcept;
+
+    std::string m_default_value{};
+    Bounds m_bounds{}; // Sorted, strictly increasing.
+    Outputs m_outputs{};
+    bool m_catch_all = false;
+};
+
+} // namespace yafiyogi::yy_values
@@ -30,17 +30,25 @@
 
 namespace yafiyogi::yy_values {
 
-void SwitchValueAction::Apply(MetricData & p_metric_data,
-                              ValueType /* p_value_type */) noexcept
+SwitchValueAction::SwitchValueAction(std::string && p_default_value,
+                                     Switch && p_switch):
+  m_default_value(std::move(p_default_value)),
+  m_switch(p_switch)
 {
-  auto do_switch = [&p_metric_data](Switch::value_ptr value, auto) {
-    p_metric_data.Value(*value);
-  };
+}
 
-  if(!m_switch.find_value(do_switch, p_metric_data.Value()).found)
+bool SwitchValueAction::Apply(MetricData & p_metric_data,
+                              ValueType /* p_value_type */) const noexcept
+{
+  if(auto output = m_switch.find(p_metric_data.Value());
+     output.has_value())
   {
-    p_metric_data.Value(m_default_value);
+    p_metric_data.Value(output.value());
+    return true;
   }
+
+  p_metric_data.Value(m_default_value);
+  return false;
 }
 
 } // namespace yafiyogi::yy_values
@@ -26,7 +26,10 @@
 
 #pragma once
 
+#include <string>
+
 #include "yy_value_action.hpp"
+#include "yy_value_switch_table.hpp"
 
 namespace yafiyogi::yy_values {
 
@@ -34,24 +37,20 @@ class SwitchValueAction:
       public ValueAction
 {
   public:
-    using Switch = yy_data::flat_map<std::string, std::string>;
+    using Switch = SwitchTable::Switch;
 
-    constexpr SwitchValueAction(std::string && p_default_value,
-                                Switch && p_switch) noexcept:
-      m_default_value(std::move(p_default_value)),
-      m_switch(std::move(p_switch))
-    {
-    }
+    SwitchValueAction(std::string && p_default_value,
+                      Switch && p_switch);
 
-    constexpr SwitchValueAction() noexcept = default;
-    constexpr SwitchValueAction(const SwitchValueAction &) noexcept = default;
-    constexpr SwitchValueAction(SwitchValueAction &&) noexcept = default;
+    SwitchValueAction() noexcept = default;
+    SwitchValueAction(const SwitchValueAction &) = default;
+    SwitchValueAction(SwitchValueAction &&) noexcept = default;
 
-    constexpr SwitchValueAction & operator=(const SwitchValueAction &) noexcept = default;
-    constexpr SwitchValueAction & operator=(SwitchValueAction &&) noexcept = default;
+    SwitchValueAction & operator=(const SwitchValueAction &) = default;
+    SwitchValueAction & operator=(SwitchValueAction &&) noexcept = default;
 
-    void Apply(MetricData & p_metric_data,
-               ValueType p_value_type) noexcept override;
+    bool Apply(MetricData & p_metric_data,
+               ValueType p_value_type) const noexcept override;
 
     static constexpr const std::string_view action_name{"switch"};
     std::string_view Name() const noexcept override
@@ -59,9 +58,15 @@ class SwitchValueAction:
       return action_name;
     }
 
+    [[nodiscard]]
+    const SwitchTable & Table() const noexcept
+    {
+      return m_switch;
+    }
+
   private:
     std::string m_default_value;
-    Switch m_switch;
+    SwitchTable m_switch;
 };
 
 } // namespace yafiyogi::yy_values
@@ -0,0 +1,177 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <string>
+#include <utility>
+
+#include "yy_cpp/yy_make_lookup.h"
+
+#include "yy_value_parse.hpp"
+#include "yy_values_metric_data.hpp"
+
+#include "yy_value_action_transform.hpp"
+
+namespace yafiyogi::yy_values {
+
+using namespace std::string_view_literals;
+
+namespace {
+
+enum class Quantity:uint8_t {Unknown, Temperature, Length, Speed, Pressure, Energy, Power};
+
+// Converts to the quantity's base unit: base = x * scale + offset.
+struct Unit
+{
+    Quantity quantity = Quantity::Unknown;
+    double scale = 1.0;
+    double offset = 0.0;
+};
+
+constexpr auto g_units =
+  yy_data::make_lookup<std::string_view, Unit>(Unit{},
+                                               {{"kelvin"sv, Unit{Quantity::Temperature, 1.0, 0.0}},
+                                                {"celsius"sv, Unit{Quantity::Temperature, 1.0, 273.15}},
+                                                {"fahrenheit"sv, Unit{Quantity::Temperature, 5.0 / 9.0, 459.67 * 5.0 / 9.0}},
+                                                {"mm"sv, Unit{Quantity::Length, 0.001, 0.0}},
+                                                {"cm"sv, Unit{Quantity::Length, 0.01, 0.0}},
+                                                {"m"sv, Unit{Quantity::Length, 1.0, 0.0}},
+                                                {"km"sv, Unit{Quantity::Length, 1000.0, 0.0}},
+                                                {"in"sv, Unit{Quantity::Length, 0.0254, 0.0}},
+                                                {"ft"sv, Unit{Quantity::Length, 0.3048, 0.0}},
+                                                {"mi"sv, Unit{Quantity::Length, 1609.344, 0.0}},
+                                                {"m/s"sv, Unit{Quantity::Speed, 1.0, 0.0}},
+                                                {"km/h"sv, Unit{Quantity::Speed, 1.0 / 3.6, 0.0}},
+                                                {"mph"sv, Unit{Quantity::Speed, 0.44704, 0.0}},
+                                                {"knot"sv, Unit{Quantity::Speed, 1852.0 / 3600.0, 0.0}},
+                                                {"pa"sv, Unit{Quantity::Pressure, 1.0, 0.0}},
+                                                {"hpa"sv, Unit{Quantity::Pressure, 100.0, 0.0}},
+                                                {"kpa"sv, Unit{Quantity::Pressure, 1000.0, 0.0}},
+                                                {"bar"sv, Unit{Quantity::Pressure, 100000.0, 0.0}},
+                                                {"psi"sv, Unit{Quantity::Pressure, 6894.757293168, 0.0}},
+                                                {"j"sv, Unit{Quantity::Energy, 1.0, 0.0}},
+                                                {"kj"sv, Unit{Quantity::Energy, 1000.0, 0.0}},
+                                                {"wh"sv, Unit{Quantity::Energy, 3600.0, 0.0}},
+                                                {"kwh"sv, Unit{Quantity::Energy, 3600000.0, 0.0}},
+                                                {"w"sv, Unit{Quantity::Power, 1.0, 0.0}},
+                                                {"kw"sv, Unit{Quantity::Power, 1000.0, 0.0}}});
+
+// Enough for the shortest round trip form of any double.
+constexpr std::size_t max_format_size = 32;
+
+} // anonymous namespace
+
+std::optional<TransformStep> unit_conversion(std::string_view p_from,
+                                             std::string_view p_to) noexcept
+{
+  const auto from = g_units.lookup(p_from);
+  const auto to = g_units.lookup(p_to);
+
+  if((Quantity::Unknown == from.quantity)
+     || (from.quantity != to.quantity))
+  {
+    return std::nullopt;
+  }
+
+  // x -> base -> p_to: ((x * from.scale + from.offset) - to.offset) / to.scale
+  return TransformStep{TransformOp::Affine,
+                       from.scale / to.scale,
+                       (from.offset - to.offset) / to.scale};
+}
+
+TransformValueAction::TransformValueAction(std::string && p_default_value,
+                                           TransformSteps && p_steps):
+  m_default_value(std::move(p_default_value))
+{
+  m_steps.reserve(p_steps.size());
+
+  for(const auto & step : p_steps)
+  {
+    if((TransformOp::Affine == step.op)
+       && !m_steps.empty()
+       && (TransformOp::Affine == m_steps.back().op))
+    {
+      // (x * a1 + b1) * a2 + b2 = x * (a1 * a2) + (b1 * a2 + b2)
+      auto & prev = m_steps.back();
+      prev.a *= step.a;
+      prev.b = prev.b * step.a + step.b;
+    }
+    else
+    {
+      m_steps.emplace_back(step);
+    }
+  }
+}
+
+bool TransformValueAction::Apply(MetricData & p_metric_data,
+                                 ValueType /* p_value_type */) const noexcept
+{
+  const auto input{numeric_value(p_metric_data, ValueType::Float)};
+
+  if(!input.has_value())
+  {
+    if(!m_default_value.empty())
+    {
+      p_metric_data.Value(m_default_value);
+    }
+    return false;
+  }
+
+  double value = input.value();
+
+  for(const auto & step : m_steps)
+  {
+    switch(step.op)
+    {
+      case TransformOp::Affine:
+        value = value * step.a + step.b;
+        break;
+
+      case TransformOp::Clamp:
+        value = std::clamp(value, step.a, step.b);
+        break;
+
+      case TransformOp::Round:
+        value = std::round(value * step.a) / step.a;
+        break;
+    }
+  }
+
+  std::array<char, max_format_size> buffer{};
+  auto [ptr, ignore_ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+
+  p_metric_data.Value(std::string_view{buffer.data(), static_cast<std::size_t>(ptr - buffer.data())});
+  p_metric_data.Type(ValueType::Float);
+  p_metric_data.Binary(value);
+  p_metric_data.Status(ValueStatus::Ok);
+
+  return true;
+}
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,113 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_value_action.hpp"
+
+namespace yafiyogi::yy_values {
+
+// One numeric step:
+//   Affine: x * a + b (scale, offset and unit conversion)
+//   Clamp:  min(max(x, a), b)
+//   Round:  round(x * a) / a, where a = 10^digits
+enum class TransformOp:uint8_t {Affine, Clamp, Round};
+
+struct TransformStep
+{
+    TransformOp op = TransformOp::Affine;
+    double a = 1.0;
+    double b = 0.0;
+
+    bool operator==(const TransformStep &) const noexcept = default;
+};
+
+using TransformSteps = yy_quad::simple_vector<TransformStep>;
+
+// Affine step converting p_from to p_to, e.g. "celsius" to
+// "fahrenheit". std::nullopt if either unit is unknown or they measure
+// different quantities.
+std::optional<TransformStep> unit_conversion(std::string_view p_from,
+                                             std::string_view p_to) noexcept;
+
+// Runs a chain of numeric steps on the parsed value. Adjacent affine
+// steps are folded when the action is built, and the whole chain costs
+// one parse and one format however long it is. Binary() is used when
+// an earlier action has parsed the value; otherwise Value() is parsed
+// as a Float whatever the declared type, so "21.5" on an Int metric is
+// transformed. The result is stored as a Float in both Value() and
+// Binary(). Values that fail to parse take the default, or are left
+// unchanged if the default is empty.
+class TransformValueAction:
+      public ValueAction
+{
+  public:
+    TransformValueAction(std::string && p_default_value,
+                         TransformSteps && p_steps);
+
+    TransformValueAction() noexcept = default;
+    TransformValueAction(const TransformValueAction &) = default;
+    TransformValueAction(TransformValueAction &&) noexcept = default;
+
+    TransformValueAction & operator=(const TransformValueAction &) = default;
+    TransformValueAction & operator=(TransformValueAction &&) noexcept = default;
+
+    bool Apply(MetricData & p_metric_data,
+               ValueType p_value_type) const noexcept override;
+
+    static constexpr const std::string_view action_name{"transform"};
+
+    // Configuration names of the individual steps.
+    static constexpr const std::string_view scale_name{"scale"};
+    static constexpr const std::string_view offset_name{"offset"};
+    static constexpr const std::string_view clamp_name{"clamp"};
+    static constexpr const std::string_view round_name{"round"};
+    static constexpr const std::string_view convert_name{"convert"};
+
+    std::string_view Name() const noexcept override
+    {
+      return action_name;
+    }
+
+    [[nodiscard]]
+    const TransformSteps & Steps() const noexcept
+    {
+      return m_steps;
+    }
+
+  private:
+    std::string m_default_value{};
+    TransformSteps m_steps{};
+};
+
+} // namespace yafiyogi::yy_values
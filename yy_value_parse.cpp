@@ -0,0 +1,197 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <variant>
+
+#include "yy_cpp/yy_make_lookup.h"
+#include "yy_cpp/yy_string_util.h"
+
+#include "yy_value_parse.hpp"
+
+namespace yafiyogi::yy_values {
+
+using namespace std::string_view_literals;
+
+namespace {
+
+enum class BoolValue:uint8_t {Invalid, True, False};
+
+constexpr auto g_bool_values =
+  yy_data::make_lookup<std::string_view, BoolValue>(BoolValue::Invalid,
+                                                    {{"true"sv, BoolValue::True},
+                                                     {"false"sv, BoolValue::False},
+                                                     {"on"sv, BoolValue::True},
+                                                     {"off"sv, BoolValue::False},
+                                                     {"yes"sv, BoolValue::True},
+                                                     {"no"sv, BoolValue::False},
+                                                     {"1"sv, BoolValue::True},
+                                                     {"0"sv, BoolValue::False}});
+
+template<typename T>
+ValueStatus parse_number(std::string_view p_value,
+                         MetricData::binary_type & p_binary) noexcept
+{
+  // from_chars() takes no '+', so strip one, but not a sign after it.
+  if(!p_value.empty() && ('+' == p_value.front()))
+  {
+    p_value.remove_prefix(1);
+
+    if(p_value.empty()
+       || ('-' == p_value.front())
+       || ('+' == p_value.front()))
+    {
+      return ValueStatus::Invalid;
+    }
+  }
+
+  T value{};
+  const char * end = p_value.data() + p_value.size();
+  auto [ptr, ec] = std::from_chars(p_value.data(), end, value);
+
+  if(std::errc::result_out_of_range == ec)
+  {
+    return ValueStatus::OutOfRange;
+  }
+
+  if((std::errc{} != ec) || (end != ptr) || p_value.empty())
+  {
+    return ValueStatus::Invalid;
+  }
+
+  p_binary = value;
+
+  return ValueStatus::Ok;
+}
+
+ValueStatus parse_bool(std::string_view p_value,
+                       MetricData::binary_type & p_binary) noexcept
+{
+  // Values longer than any keyword can't match.
+  constexpr std::size_t max_bool_size = 5;
+  if(p_value.size() > max_bool_size)
+  {
+    return ValueStatus::Invalid;
+  }
+
+  std::array<char, max_bool_size> buffer{};
+  for(std::size_t idx = 0; idx < p_value.size(); ++idx)
+  {
+    char ch = p_value[idx];
+    buffer[idx] = (('A' <= ch) && ('Z' >= ch)) ? static_cast<char>(ch - 'A' + 'a') : ch;
+  }
+
+  auto value = g_bool_values.lookup(std::string_view{buffer.data(), p_value.size()});
+  if(BoolValue::Invalid == value)
+  {
+    return ValueStatus::Invalid;
+  }
+
+  p_binary = (BoolValue::True == value);
+
+  return ValueStatus::Ok;
+}
+
+} // anonymous namespace
+
+ValueStatus parse_value(std::string_view p_value,
+                        ValueType p_value_type,
+                        MetricData::binary_type & p_binary) noexcept
+{
+  p_value = yy_util::trim(p_value);
+
+  switch(p_value_type)
+  {
+    case ValueType::Int:
+      return parse_number<int64_t>(p_value, p_binary);
+
+    case ValueType::UInt:
+      return parse_number<uint64_t>(p_value, p_binary);
+
+    case ValueType::Float:
+      return parse_number<double>(p_value, p_binary);
+
+    case ValueType::Bool:
+      return parse_bool(p_value, p_binary);
+
+    default:
+      break;
+  }
+
+  return ValueStatus::Unparsed;
+}
+
+void parse_value(MetricData & p_metric_data) noexcept
+{
+  MetricData::binary_type binary{};
+
+  p_metric_data.Status(parse_value(p_metric_data.Value(), p_metric_data.Type(), binary));
+  p_metric_data.Binary(binary);
+}
+
+std::optional<double> numeric_value(const MetricData & p_metric_data,
+                                    ValueType p_value_type) noexcept
+{
+  MetricData::binary_type binary{};
+  ValueStatus status = p_metric_data.Status();
+
+  // A String value has no Binary(), even once final.
+  if(ValueType::String == p_metric_data.Type())
+  {
+    status = ValueStatus::Unparsed;
+  }
+
+  if(ValueStatus::Ok == status)
+  {
+    binary = p_metric_data.Binary();
+  }
+  else if(ValueStatus::Unparsed == status)
+  {
+    if((ValueType::String == p_value_type)
+       || (ValueType::Unknown == p_value_type))
+    {
+      p_value_type = ValueType::Float;
+    }
+
+    status = parse_value(p_metric_data.Value(), p_value_type, binary);
+  }
+
+  if(ValueStatus::Ok != status)
+  {
+    return std::nullopt;
+  }
+
+  return std::visit([](auto p_binary) {
+    return static_cast<double>(p_binary);
+  }, binary);
+}
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,54 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include "yy_value_type.hpp"
+#include "yy_values_metric_data.hpp"
+
+namespace yafiyogi::yy_values {
+
+// Convert p_value according to p_value_type, storing the result in
+// p_binary. String and Unknown types are left Unparsed.
+ValueStatus parse_value(std::string_view p_value,
+                        ValueType p_value_type,
+                        MetricData::binary_type & p_binary) noexcept;
+
+// Parse p_metric_data's Value() into Binary() and record the outcome
+// in Status().
+void parse_value(MetricData & p_metric_data) noexcept;
+
+// p_metric_data's value as a double. Binary() is used when an earlier
+// action has already parsed it. Otherwise Value() is parsed as
+// p_value_type, with String and Unknown parsed as Float. std::nullopt
+// if the value is not numeric.
+std::optional<double> numeric_value(const MetricData & p_metric_data,
+                                    ValueType p_value_type) noexcept;
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,293 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "yy_values_hash.hpp"
+
+#include "yy_value_switch_table.hpp"
+
+namespace yafiyogi::yy_values {
+
+namespace {
+
+uint64_t key_prefix(std::string_view p_key) noexcept
+{
+  uint64_t prefix = 0;
+  std::memcpy(&prefix, p_key.data(), std::min(p_key.size(), sizeof(prefix)));
+
+  return prefix;
+}
+
+SwitchTable::Strategy select_strategy(size_type p_num_entries) noexcept
+{
+  if(p_num_entries <= switch_table_detail::linear_max)
+  {
+    return SwitchTable::Strategy::Linear;
+  }
+
+  if(p_num_entries <= switch_table_detail::binary_max)
+  {
+    return SwitchTable::Strategy::Binary;
+  }
+
+  return SwitchTable::Strategy::PerfectHash;
+}
+
+} // anonymous namespace
+
+SwitchTable::SwitchTable(const Switch & p_switch):
+  SwitchTable(p_switch, select_strategy(p_switch.size()))
+{
+}
+
+SwitchTable::SwitchTable(const Switch & p_switch,
+                         Strategy p_strategy,
+                         uint32_t p_max_seed)
+{
+  const size_type num_entries = p_switch.size();
+  m_entries.reserve(num_entries);
+
+  // flat_map iterates in key order, so m_entries is sorted.
+  p_switch.visit([this](const auto & p_key, const auto & p_output) {
+    Entry entry{};
+    entry.key_offset = static_cast<uint32_t>(m_pool.size());
+    entry.key_size = static_cast<uint32_t>(p_key.size());
+    m_pool.append(p_key);
+    entry.output_offset = static_cast<uint32_t>(m_pool.size());
+    entry.output_size = static_cast<uint32_t>(p_output.size());
+    m_pool.append(p_output);
+
+    m_entries.emplace_back(entry);
+  });
+
+  switch(p_strategy)
+  {
+    case Strategy::Linear:
+      m_strategy = Strategy::Linear;
+      m_prefixes.reserve(num_entries);
+      for(const auto & entry : m_entries)
+      {
+        m_prefixes.emplace_back(key_prefix(key(entry)));
+      }
+      break;
+
+    case Strategy::Binary:
+      m_strategy = Strategy::Binary;
+      break;
+
+    case Strategy::PerfectHash:
+    {
+      Words hashes{};
+      hashes.reserve(num_entries);
+      for(const auto & entry : m_entries)
+      {
+        hashes.emplace_back(hash_string(key(entry)));
+      }
+
+      if(build_perfect_hash(hashes, p_max_seed))
+      {
+        m_strategy = Strategy::PerfectHash;
+      }
+      else
+      {
+        m_seeds.clear();
+        m_slots.clear();
+        m_strategy = Strategy::Binary;
+        m_fell_back = true;
+      }
+    }
+    break;
+  }
+}
+
+// Hash and displace: keys are grouped into buckets by one half of
+// their hash, then each bucket, largest first, searches for a seed
+// that places all its keys in free slots.
+bool SwitchTable::build_perfect_hash(const Words & p_hashes,
+                                     uint32_t p_max_seed)
+{
+  const size_type num_entries = p_hashes.size();
+  const size_type num_buckets = std::max(size_type{1}, num_entries / switch_table_detail::keys_per_bucket);
+  const size_type num_slots = std::bit_ceil(num_entries + (num_entries / 4));
+
+  m_slot_mask = num_slots - 1;
+  m_seeds.reserve(num_buckets);
+  for(size_type idx = 0; idx < num_buckets; ++idx)
+  {
+    m_seeds.emplace_back(0);
+  }
+
+  m_slots.reserve(num_slots);
+  for(size_type idx = 0; idx < num_slots; ++idx)
+  {
+    m_slots.emplace_back(0);
+  }
+
+  yy_quad::simple_vector<Indices> buckets{};
+  buckets.reserve(num_buckets);
+  for(size_type idx = 0; idx < num_buckets; ++idx)
+  {
+    buckets.emplace_back();
+  }
+
+  for(size_type idx = 0; idx < num_entries; ++idx)
+  {
+    buckets[bucket(p_hashes[idx])].emplace_back(static_cast<uint32_t>(idx));
+  }
+
+  Indices order{};
+  order.reserve(num_buckets);
+  for(size_type idx = 0; idx < num_buckets; ++idx)
+  {
+    order.emplace_back(static_cast<uint32_t>(idx));
+  }
+
+  std::stable_sort(order.begin(), order.end(), [&buckets](uint32_t p_lhs, uint32_t p_rhs) {
+    return buckets[p_lhs].size() > buckets[p_rhs].size();
+  });
+
+  Indices placed{};
+  for(const auto bucket_idx : order)
+  {
+    const auto & bucket_entries = buckets[bucket_idx];
+    if(bucket_entries.empty())
+    {
+      break;
+    }
+
+    bool found = false;
+    for(uint32_t seed = 0; !found && (seed < p_max_seed); ++seed)
+    {
+      placed.clear();
+      found = true;
+
+      for(const auto entry_idx : bucket_entries)
+      {
+        const auto slot = static_cast<uint32_t>(hash_combine(p_hashes[entry_idx], seed) & m_slot_mask);
+        if((0 != m_slots[slot])
+           || (placed.end() != std::find(placed.begin(), placed.end(), slot)))
+        {
+          found = false;
+          break;
+        }
+        placed.emplace_back(slot);
+      }
+
+      if(found)
+      {
+        m_seeds[bucket_idx] = seed;
+        for(size_type idx = 0; idx < placed.size(); ++idx)
+        {
+          m_slots[placed[idx]] = bucket_entries[idx] + 1;
+        }
+      }
+    }
+
+    if(!found)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::optional<std::string_view> SwitchTable::find(std::string_view p_input) const noexcept
+{
+  switch(m_strategy)
+  {
+    case Strategy::Linear:
+      return find_linear(p_input);
+
+    case Strategy::Binary:
+      return find_binary(p_input);
+
+    case Strategy::PerfectHash:
+      return find_hash(p_input);
+  }
+
+  return std::nullopt;
+}
+
+// Compares packed 8 byte prefixes first; only candidates whose prefix
+// matches are compared in full.
+std::optional<std::string_view> SwitchTable::find_linear(std::string_view p_input) const noexcept
+{
+  const uint64_t prefix = key_prefix(p_input);
+  const size_type num_entries = m_prefixes.size();
+
+  for(size_type idx = 0; idx < num_entries; ++idx)
+  {
+    if(prefix == m_prefixes[idx])
+    {
+      if(const auto & entry = m_entries[idx];
+         key(entry) == p_input)
+      {
+        return output(entry);
+      }
+    }
+  }
+
+  return std::nullopt;
+}
+
+std::optional<std::string_view> SwitchTable::find_binary(std::string_view p_input) const noexcept
+{
+  auto pos = std::lower_bound(m_entries.begin(), m_entries.end(), p_input,
+                              [this](const Entry & p_entry, std::string_view p_key) {
+                                return key(p_entry) < p_key;
+                              });
+
+  if((m_entries.end() != pos) && (key(*pos) == p_input))
+  {
+    return output(*pos);
+  }
+
+  return std::nullopt;
+}
+
+std::optional<std::string_view> SwitchTable::find_hash(std::string_view p_input) const noexcept
+{
+  const uint64_t input_hash = hash_string(p_input);
+  const auto seed = m_seeds[bucket(input_hash)];
+
+  if(const auto entry_idx = m_slots[hash_combine(input_hash, seed) & m_slot_mask];
+     0 != entry_idx)
+  {
+    if(const auto & entry = m_entries[entry_idx - 1];
+       key(entry) == p_input)
+    {
+      return output(entry);
+    }
+  }
+
+  return std::nullopt;
+}
+
+} // namespace yafiyogi::yy_values
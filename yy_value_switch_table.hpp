@@ -0,0 +1,152 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "yy_cpp/yy_flat_map.h"
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+namespace yafiyogi::yy_values {
+namespace switch_table_detail {
+
+// Tables up to linear_max entries are scanned, up to binary_max are
+// binary searched, and larger ones use a perfect hash.
+inline constexpr size_type linear_max = 8;
+inline constexpr size_type binary_max = 32;
+
+// Average keys per perfect hash bucket, and the seeds tried per
+// bucket before giving up and binary searching instead.
+inline constexpr size_type keys_per_bucket = 4;
+inline constexpr uint32_t max_seed = 1U << 16;
+
+} // namespace switch_table_detail
+
+// Read only input -> output lookup built once at configure time. Keys
+// and outputs are packed into one string pool; the lookup strategy is
+// chosen from the table size.
+class SwitchTable final
+{
+  public:
+    enum class Strategy:uint8_t {Linear, Binary, PerfectHash};
+
+    using Switch = yy_data::flat_map<std::string, std::string>;
+
+    explicit SwitchTable(const Switch & p_switch);
+
+    // Uses p_strategy whatever the table size, trying up to p_max_seed
+    // seeds per perfect hash bucket. For tests and benchmarks.
+    SwitchTable(const Switch & p_switch,
+                Strategy p_strategy,
+                uint32_t p_max_seed = switch_table_detail::max_seed);
+
+    SwitchTable() noexcept = default;
+    SwitchTable(const SwitchTable &) = default;
+    SwitchTable(SwitchTable &&) noexcept = default;
+
+    SwitchTable & operator=(const SwitchTable &) = default;
+    SwitchTable & operator=(SwitchTable &&) noexcept = default;
+
+    [[nodiscard]]
+    std::optional<std::string_view> find(std::string_view p_input) const noexcept;
+
+    [[nodiscard]]
+    Strategy strategy() const noexcept
+    {
+      return m_strategy;
+    }
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+      return m_entries.size();
+    }
+
+    // True if no perfect hash was found and the table binary searches
+    // instead. The caller decides whether to report it.
+    [[nodiscard]]
+    bool fell_back() const noexcept
+    {
+      return m_fell_back;
+    }
+
+  private:
+    struct Entry
+    {
+        uint32_t key_offset = 0;
+        uint32_t key_size = 0;
+        uint32_t output_offset = 0;
+        uint32_t output_size = 0;
+    };
+
+    using Entries = yy_quad::simple_vector<Entry>;
+    using Words = yy_quad::simple_vector<uint64_t>;
+    using Indices = yy_quad::simple_vector<uint32_t>;
+
+    [[nodiscard]]
+    std::string_view key(const Entry & p_entry) const noexcept
+    {
+      return std::string_view{m_pool}.substr(p_entry.key_offset, p_entry.key_size);
+    }
+
+    [[nodiscard]]
+    std::string_view output(const Entry & p_entry) const noexcept
+    {
+      return std::string_view{m_pool}.substr(p_entry.output_offset, p_entry.output_size);
+    }
+
+    [[nodiscard]]
+    uint64_t bucket(uint64_t p_hash) const noexcept
+    {
+      return (p_hash >> 32) % m_seeds.size();
+    }
+
+    bool build_perfect_hash(const Words & p_hashes,
+                            uint32_t p_max_seed);
+
+    [[nodiscard]]
+    std::optional<std::string_view> find_linear(std::string_view p_input) const noexcept;
+    [[nodiscard]]
+    std::optional<std::string_view> find_binary(std::string_view p_input) const noexcept;
+    [[nodiscard]]
+    std::optional<std::string_view> find_hash(std::string_view p_input) const noexcept;
+
+    std::string m_pool{};
+    Entries m_entries{}; // Sorted by key.
+    Words m_prefixes{}; // Linear: first 8 key bytes, zero padded.
+    Indices m_seeds{}; // Perfect hash: one seed per bucket.
+    Indices m_slots{}; // Perfect hash: entry index + 1, 0 if empty.
+    uint64_t m_slot_mask = 0;
+    Strategy m_strategy = Strategy::Linear;
+    bool m_fell_back = false;
+};
+
+} // namespace yafiyogi::yy_values
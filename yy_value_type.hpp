@@ -26,8 +26,13 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace yafiyogi::yy_values {
 
 enum class ValueType:uint8_t {Unknown, String, Int, UInt, Float, Bool};
 
+// Result of converting a value string to MetricData::Binary.
+enum class ValueStatus:uint8_t {Unparsed, Ok, Invalid, OutOfRange};
+
 } // namespace yafiyogi::yy_values
@@ -0,0 +1,331 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <tuple>
+#include <variant>
+
+#include "spdlog/spdlog.h"
+
+#include "yy_values_metric_id.hpp"
+
+#include "yy_values_aggregator.hpp"
+
+namespace yafiyogi::yy_values {
+
+using namespace std::string_view_literals;
+
+namespace {
+
+// Enough for the shortest round trip form of any double.
+constexpr std::size_t max_format_size = 32;
+
+} // anonymous namespace
+
+Aggregator::Aggregator(const AggregateConfig & p_config,
+                       size_type p_expected_series):
+  m_config(p_config),
+  m_aggregate_label(intern_label(aggregator_detail::aggregate_label))
+{
+  if(m_config.window.count() <= 0)
+  {
+    spdlog::warn("Aggregation window must be positive, using 1s."sv);
+    m_config.window = std::chrono::seconds{1};
+  }
+
+  if((m_config.slide.count() <= 0)
+     || (m_config.slide >= m_config.window))
+  {
+    m_config.slide = m_config.window;
+  }
+
+  m_num_panes = static_cast<size_type>(m_config.window / m_config.slide);
+  if((m_num_panes > aggregator_detail::max_panes)
+     || ((m_config.window % m_config.slide).count() != 0))
+  {
+    m_num_panes = std::min(m_num_panes, aggregator_detail::max_panes);
+    spdlog::warn("Aggregation window [{}ns] is not a multiple of slide [{}ns] up to [{}] panes, using [{}ns]."sv,
+                 m_config.window.count(),
+                 m_config.slide.count(),
+                 aggregator_detail::max_panes,
+                 (m_config.slide * m_num_panes).count());
+    m_config.window = m_config.slide * m_num_panes;
+  }
+
+  m_slide_ns = m_config.slide.count();
+
+  m_series = SeriesTable<SeriesState>{p_expected_series};
+  m_panes.reserve(p_expected_series * m_num_panes);
+}
+
+int64_t Aggregator::pane_of(timestamp_type p_timestamp) const noexcept
+{
+  const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(p_timestamp.time_since_epoch()).count();
+  int64_t pane = ns / m_slide_ns;
+
+  if((ns < 0) && (0 != (ns % m_slide_ns)))
+  {
+    --pane;
+  }
+
+  return pane;
+}
+
+void Aggregator::Add(const MetricData & p_metric_data,
+                     MetricDataVector & p_out)
+{
+  if(ValueStatus::Ok != p_metric_data.Status())
+  {
+    ++m_dropped;
+    return;
+  }
+
+  const int64_t pane = pane_of(p_metric_data.Timestamp());
+
+  if(no_pane == m_current_pane)
+  {
+    m_current_pane = pane;
+  }
+  else if(pane > m_current_pane)
+  {
+    close_panes(pane, p_out);
+  }
+  else if(pane <= (m_current_pane - static_cast<int64_t>(m_num_panes)))
+  {
+    // Every window holding this pane has been emitted.
+    ++m_dropped;
+    return;
+  }
+
+  const double value = std::visit([](auto p_binary) {
+    return static_cast<double>(p_binary);
+  }, p_metric_data.Binary());
+
+  auto & series = find_or_add(p_metric_data);
+  series.last_pane = std::max(series.last_pane, pane);
+
+  const auto pane_idx = static_cast<size_type>(((pane % static_cast<int64_t>(m_num_panes)) + static_cast<int64_t>(m_num_panes))
+                                               % static_cast<int64_t>(m_num_panes));
+
+  auto & acc = m_panes[(series.block * m_num_panes) + pane_idx];
+  if(pane != acc.pane)
+  {
+    acc = Pane{pane, value, value, value, 1};
+  }
+  else
+  {
+    acc.min = std::min(acc.min, value);
+    acc.max = std::max(acc.max, value);
+    acc.sum += value;
+    ++acc.count;
+  }
+}
+
+void Aggregator::Add(std::span<const MetricData> p_metric_data,
+                     MetricDataVector & p_out)
+{
+  for(const auto & metric_data : p_metric_data)
+  {
+    Add(metric_data, p_out);
+  }
+}
+
+void Aggregator::Advance(timestamp_type p_now,
+                         MetricDataVector & p_out)
+{
+  if(const int64_t pane = pane_of(p_now);
+     (no_pane != m_current_pane) && (pane > m_current_pane))
+  {
+    close_panes(pane, p_out);
+  }
+}
+
+void Aggregator::clear() noexcept
+{
+  m_series.clear();
+  m_panes.clear();
+  m_num_blocks = 0;
+  m_num_free_blocks = 0;
+  m_current_pane = no_pane;
+  m_dropped = 0;
+}
+
+Aggregator::SeriesState & Aggregator::find_or_add(const MetricData & p_metric_data)
+{
+  auto [series, added] = m_series.find_or_add(p_metric_data);
+
+  if(added)
+  {
+    if(0 != m_num_free_blocks)
+    {
+      --m_num_free_blocks;
+      series.block = m_free_blocks[m_num_free_blocks];
+
+      for(size_type pane_idx = 0; pane_idx < m_num_panes; ++pane_idx)
+      {
+        m_panes[(series.block * m_num_panes) + pane_idx] = Pane{};
+      }
+    }
+    else
+    {
+      series.block = m_num_blocks;
+      ++m_num_blocks;
+
+      for(size_type pane_idx = 0; pane_idx < m_num_panes; ++pane_idx)
+      {
+        m_panes.emplace_back();
+      }
+    }
+  }
+
+  return series;
+}
+
+// Every open window starts at or after the oldest pane, so a series
+// whose last sample is older can never be emitted again.
+void Aggregator::evict_idle()
+{
+  const int64_t oldest_pane = m_current_pane - static_cast<int64_t>(m_num_panes) + 1;
+  auto is_idle = [oldest_pane](const SeriesState & p_series) {
+    return p_series.last_pane < oldest_pane;
+  };
+
+  m_series.visit([this, &is_idle](const SeriesState & p_series, std::string_view) {
+    if(is_idle(p_series))
+    {
+      if(m_num_free_blocks < m_free_blocks.size())
+      {
+        m_free_blocks[m_num_free_blocks] = p_series.block;
+      }
+      else
+      {
+        m_free_blocks.emplace_back(p_series.block);
+      }
+      ++m_num_free_blocks;
+    }
+  });
+
+  std::ignore = m_series.erase_if(is_idle);
+}
+
+// Windows ending after the last pane with data are empty, so at most
+// m_num_panes windows are emitted however far time moves.
+void Aggregator::close_panes(int64_t p_until,
+                             MetricDataVector & p_out)
+{
+  const int64_t last = std::min(p_until - 1,
+                                m_current_pane + static_cast<int64_t>(m_num_panes) - 1);
+
+  for(int64_t pane = m_current_pane; pane <= last; ++pane)
+  {
+    emit_window(pane, p_out);
+  }
+
+  m_current_pane = p_until;
+  evict_idle();
+}
+
+void Aggregator::emit_window(int64_t p_last_pane,
+                             MetricDataVector & p_out)
+{
+  const int64_t first_pane = p_last_pane - static_cast<int64_t>(m_num_panes) + 1;
+  const timestamp_type window_end{std::chrono::nanoseconds{(p_last_pane + 1) * m_slide_ns}};
+  const auto fns = m_config.functions;
+
+  m_series.visit([&](const SeriesState & p_series, std::string_view p_identity) {
+    if(p_series.last_pane < first_pane)
+    {
+      return;
+    }
+
+    Pane window{};
+
+    for(size_type pane_idx = 0; pane_idx < m_num_panes; ++pane_idx)
+    {
+      const auto & acc = m_panes[(p_series.block * m_num_panes) + pane_idx];
+
+      if((acc.pane >= first_pane) && (acc.pane <= p_last_pane) && (0 != acc.count))
+      {
+        window.min = (0 == window.count) ? acc.min : std::min(window.min, acc.min);
+        window.max = (0 == window.count) ? acc.max : std::max(window.max, acc.max);
+        window.sum += acc.sum;
+        window.count += acc.count;
+      }
+    }
+
+    if(0 == window.count)
+    {
+      return;
+    }
+
+    SeriesTable<SeriesState>::decode(p_identity, m_template);
+    m_template.Timestamp(window_end);
+
+    if(has_fn(fns, AggregateFn::Count))
+    {
+      emit("count"sv, static_cast<double>(window.count), p_out);
+    }
+    if(has_fn(fns, AggregateFn::Sum))
+    {
+      emit("sum"sv, window.sum, p_out);
+    }
+    if(has_fn(fns, AggregateFn::Min))
+    {
+      emit("min"sv, window.min, p_out);
+    }
+    if(has_fn(fns, AggregateFn::Max))
+    {
+      emit("max"sv, window.max, p_out);
+    }
+    if(has_fn(fns, AggregateFn::Avg))
+    {
+      emit("avg"sv, window.sum / static_cast<double>(window.count), p_out);
+    }
+  });
+}
+
+void Aggregator::emit(std::string_view p_fn_name,
+                      double p_value,
+                      MetricDataVector & p_out)
+{
+  m_scratch = m_template;
+  m_scratch.Labels().set_label(m_aggregate_label, p_fn_name);
+
+  std::array<char, max_format_size> buffer{};
+  auto [ptr, ignore_ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), p_value);
+
+  m_scratch.Value(std::string_view{buffer.data(), static_cast<std::size_t>(ptr - buffer.data())});
+  m_scratch.Type(ValueType::Float);
+  m_scratch.Binary(p_value);
+  m_scratch.Status(ValueStatus::Ok);
+  m_scratch.Unchanged(false);
+
+  p_out.swap_data_back(m_scratch);
+}
+
+} // namespace yafiyogi::yy_values
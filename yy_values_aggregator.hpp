@@ -0,0 +1,187 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_values_label_id.hpp"
+#include "yy_values_metric_data.hpp"
+#include "yy_values_series_table.hpp"
+
+namespace yafiyogi::yy_values {
+namespace aggregator_detail {
+
+// Most panes a sliding window may be divided into.
+inline constexpr size_type max_panes = 64;
+
+inline constexpr std::string_view aggregate_label{"aggregate"};
+
+} // namespace aggregator_detail
+
+enum class AggregateFn:uint8_t
+{
+  None = 0,
+  Count = 1 << 0,
+  Sum = 1 << 1,
+  Min = 1 << 2,
+  Max = 1 << 3,
+  Avg = 1 << 4,
+  All = Count | Sum | Min | Max | Avg
+};
+
+constexpr AggregateFn operator|(AggregateFn p_lhs, AggregateFn p_rhs) noexcept
+{
+  return static_cast<AggregateFn>(static_cast<uint8_t>(p_lhs) | static_cast<uint8_t>(p_rhs));
+}
+
+constexpr bool has_fn(AggregateFn p_fns, AggregateFn p_fn) noexcept
+{
+  return 0 != (static_cast<uint8_t>(p_fns) & static_cast<uint8_t>(p_fn));
+}
+
+struct AggregateConfig
+{
+    std::chrono::nanoseconds window{std::chrono::seconds{60}};
+    // Zero for tumbling windows. Otherwise a new window closes every
+    // slide; window must be a multiple of it.
+    std::chrono::nanoseconds slide{0};
+    AggregateFn functions = AggregateFn::All;
+};
+
+// Downsamples MetricData per series (MetricId + Labels) into windows.
+// Windows are aligned to multiples of the slide and are closed by
+// event time: a sample past the end of the open window closes it, and
+// Advance() closes windows when no samples arrive. Each closed window
+// emits one MetricData per function, labelled 'aggregate', timestamped
+// at the window end. Samples for a window already closed are dropped.
+//
+// Series live in a SeriesTable. A series costs one table entry, one
+// fixed size accumulator per pane, and its name and labels packed once
+// into the table's string pool. A series with no samples in any open
+// window is evicted when a window closes, and its accumulators are
+// reused by the next new series.
+class Aggregator final
+{
+  public:
+    explicit Aggregator(const AggregateConfig & p_config,
+                        size_type p_expected_series = 0);
+
+    Aggregator() = delete;
+    Aggregator(const Aggregator &) = default;
+    Aggregator(Aggregator &&) noexcept = default;
+
+    Aggregator & operator=(const Aggregator &) = default;
+    Aggregator & operator=(Aggregator &&) noexcept = default;
+
+    // Only samples with a parsed numeric value are aggregated.
+    void Add(const MetricData & p_metric_data,
+             MetricDataVector & p_out);
+    void Add(std::span<const MetricData> p_metric_data,
+             MetricDataVector & p_out);
+
+    // Closes every window ending at or before p_now.
+    void Advance(timestamp_type p_now,
+                 MetricDataVector & p_out);
+
+    [[nodiscard]]
+    size_type Series() const noexcept
+    {
+      return m_series.size();
+    }
+
+    // Samples dropped as late or non numeric.
+    [[nodiscard]]
+    uint64_t Dropped() const noexcept
+    {
+      return m_dropped;
+    }
+
+    void clear() noexcept;
+
+  private:
+    static constexpr int64_t no_pane = std::numeric_limits<int64_t>::min();
+
+    struct SeriesState
+    {
+        // Index of the series' m_num_panes accumulators in m_panes.
+        size_type block = 0;
+        int64_t last_pane = no_pane;
+    };
+
+    struct Pane
+    {
+        int64_t pane = no_pane;
+        double min = 0.0;
+        double max = 0.0;
+        double sum = 0.0;
+        uint64_t count = 0;
+    };
+
+    using Panes = yy_quad::simple_vector<Pane>;
+    using Blocks = yy_quad::simple_vector<size_type>;
+
+    [[nodiscard]]
+    int64_t pane_of(timestamp_type p_timestamp) const noexcept;
+
+    [[nodiscard]]
+    SeriesState & find_or_add(const MetricData & p_metric_data);
+    void evict_idle();
+
+    void close_panes(int64_t p_until,
+                     MetricDataVector & p_out);
+    void emit_window(int64_t p_last_pane,
+                     MetricDataVector & p_out);
+    void emit(std::string_view p_fn_name,
+              double p_value,
+              MetricDataVector & p_out);
+
+    AggregateConfig m_config{};
+    int64_t m_slide_ns = 0;
+    size_type m_num_panes = 1;
+    LabelId m_aggregate_label{};
+
+    SeriesTable<SeriesState> m_series{};
+    Panes m_panes{}; // m_num_panes per series block.
+    size_type m_num_blocks = 0;
+    Blocks m_free_blocks{};
+    size_type m_num_free_blocks = 0;
+
+    int64_t m_current_pane = no_pane;
+    uint64_t m_dropped = 0;
+
+    MetricData m_template{};
+    MetricData m_scratch{};
+};
+
+} // namespace yafiyogi::yy_values
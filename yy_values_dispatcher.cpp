@@ -0,0 +1,204 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <tuple>
+
+#include "yy_values_dispatcher.hpp"
+
+namespace yafiyogi::yy_values {
+
+namespace {
+
+size_type shard_count(size_type p_num_shards) noexcept
+{
+  if(0 == p_num_shards)
+  {
+    p_num_shards = std::thread::hardware_concurrency();
+  }
+
+  return std::max(p_num_shards, size_type{1});
+}
+
+} // anonymous namespace
+
+MetricsDispatcher::MetricsDispatcher(MetricsMap && p_metrics,
+                                     size_type p_num_shards):
+  m_metrics(std::move(p_metrics)),
+  m_contexts(create_contexts(m_metrics)),
+  m_shards(shard_count(p_num_shards)),
+  m_start(static_cast<std::ptrdiff_t>(m_shards.size() + 1)),
+  m_done(static_cast<std::ptrdiff_t>(m_shards.size() + 1))
+{
+  // Greedily balance handlers across shards by number of metrics.
+  yy_quad::simple_vector<size_type> shard_load(m_shards.size());
+
+  m_handlers.reserve(m_metrics.size());
+  m_metrics.visit([this, &shard_load](const auto & p_handler_id,
+                                      const auto & p_handler_metrics) {
+    auto min_load = std::min_element(shard_load.begin(), shard_load.end());
+    auto shard_idx = static_cast<size_type>(min_load - shard_load.begin());
+
+    *min_load += std::max(p_handler_metrics.size(), size_type{1});
+
+    yy_data::observer_ptr<MetricContexts> handler_contexts{};
+    std::ignore = m_contexts.find_value([&handler_contexts](auto p_contexts, auto) {
+      handler_contexts = yy_data::observer_ptr<MetricContexts>{p_contexts};
+    }, p_handler_id);
+
+    m_handlers.emplace(std::string{p_handler_id},
+                       Handler{shard_idx,
+                               yy_data::observer_ptr<const Metrics>{&p_handler_metrics},
+                               handler_contexts});
+  });
+
+  m_workers.reserve(m_shards.size());
+  try
+  {
+    for(size_type idx = 0; idx < m_shards.size(); ++idx)
+    {
+      m_workers.emplace_back([this, idx]() { Work(idx); });
+    }
+  }
+  catch(...)
+  {
+    // Workers that never started can't arrive, so drop them from
+    // the barrier before stopping the ones that did.
+    for(size_type idx = m_workers.size(); idx < m_shards.size(); ++idx)
+    {
+      m_start.arrive_and_drop();
+    }
+    Stop();
+    throw;
+  }
+}
+
+MetricsDispatcher::~MetricsDispatcher() noexcept
+{
+  Stop();
+}
+
+void MetricsDispatcher::Stop() noexcept
+{
+  m_stop.store(true, std::memory_order_relaxed);
+  m_start.arrive_and_wait();
+  m_workers.clear();
+}
+
+bool MetricsDispatcher::Add(std::string_view p_handler_id,
+                            const MetricEvent & p_event)
+{
+  auto do_add = [this, &p_event](auto p_handler, auto) {
+    m_shards[p_handler->shard].events.emplace_back(ShardEvent{p_handler->metrics,
+                                                              p_handler->contexts,
+                                                              p_event});
+  };
+
+  return m_handlers.find_value(do_add, p_handler_id).found;
+}
+
+void MetricsDispatcher::Dispatch(MetricDataVectorPtr p_metric_data)
+{
+  m_start.arrive_and_wait();
+  m_done.arrive_and_wait();
+
+  std::exception_ptr error{};
+  for(auto & shard : m_shards)
+  {
+    if(shard.error && !error)
+    {
+      error = shard.error;
+    }
+    shard.error = nullptr;
+  }
+
+  if(error)
+  {
+    for(auto & shard : m_shards)
+    {
+      shard.events.clear(yy_data::ClearAction::Keep);
+      shard.metric_data.clear(yy_data::ClearAction::Keep);
+    }
+    std::rethrow_exception(error);
+  }
+
+  size_type total = p_metric_data->size();
+  for(const auto & shard : m_shards)
+  {
+    total += shard.metric_data.size();
+  }
+  p_metric_data->reserve(total);
+
+  for(auto & shard : m_shards)
+  {
+    for(auto & metric_data : shard.metric_data)
+    {
+      p_metric_data->swap_data_back(metric_data);
+    }
+
+    shard.events.clear(yy_data::ClearAction::Keep);
+    shard.metric_data.clear(yy_data::ClearAction::Keep);
+  }
+}
+
+void MetricsDispatcher::Work(size_type p_shard_idx) noexcept
+{
+  auto & shard = m_shards[p_shard_idx];
+  MetricDataVectorPtr metric_data{&shard.metric_data};
+
+  while(true)
+  {
+    m_start.arrive_and_wait();
+    if(m_stop.load(std::memory_order_relaxed))
+    {
+      break;
+    }
+
+    try
+    {
+      for(const auto & shard_event : shard.events)
+      {
+        const auto & metrics = *shard_event.metrics;
+        auto & contexts = *shard_event.contexts;
+
+        for(size_type idx = 0; idx < metrics.size(); ++idx)
+        {
+          metrics[idx]->Event(contexts[idx], shard_event.event, metric_data);
+        }
+      }
+    }
+    catch(...)
+    {
+      shard.error = std::current_exception();
+    }
+
+    m_done.arrive_and_wait();
+  }
+}
+
+} // namespace yafiyogi::yy_values
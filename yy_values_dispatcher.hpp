@@ -0,0 +1,143 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <atomic>
+#include <barrier>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "yy_cpp/yy_flat_map.h"
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_values_metric.hpp"
+#include "yy_values_metric_data.hpp"
+
+namespace yafiyogi::yy_values {
+
+// Runs Metric::Event on a pool of worker threads. Each handler is
+// owned by exactly one shard (worker) and the dispatcher keeps one
+// MetricContext per Metric, so workers only call the const Event()
+// overloads, never touch a Metric's own context and take no locks
+// while processing.
+//
+// Usage: Add() events from one thread, then Dispatch() to process
+// them all and merge the shard outputs. Event views passed to Add()
+// must stay valid until Dispatch() returns. Output is grouped by
+// shard, and within a shard is in Add() order.
+class MetricsDispatcher final
+{
+  public:
+    // p_num_shards == 0 uses one shard per hardware thread.
+    explicit MetricsDispatcher(MetricsMap && p_metrics,
+                               size_type p_num_shards = 0);
+    ~MetricsDispatcher() noexcept;
+
+    MetricsDispatcher(const MetricsDispatcher &) = delete;
+    MetricsDispatcher(MetricsDispatcher &&) = delete;
+
+    MetricsDispatcher & operator=(const MetricsDispatcher &) = delete;
+    MetricsDispatcher & operator=(MetricsDispatcher &&) = delete;
+
+    // Returns false if p_handler_id has no metrics.
+    bool Add(std::string_view p_handler_id,
+             const MetricEvent & p_event);
+
+    // If a Metric throws, the exception is rethrown here and the
+    // output of this dispatch is discarded.
+    void Dispatch(MetricDataVectorPtr p_metric_data);
+
+    // Visitor is called with (handler_id, const Metric &, MetricStatsSnapshot &&)
+    // for every metric. Safe to call while Dispatch() is running.
+    template<typename Visitor>
+    void VisitStats(Visitor && visitor) const
+    {
+      m_handlers.visit([&visitor](const auto & p_handler_id,
+                                  const auto & p_handler) {
+        const auto & handler_metrics = *p_handler.metrics;
+        const auto & handler_contexts = *p_handler.contexts;
+
+        for(size_type idx = 0; idx < handler_metrics.size(); ++idx)
+        {
+          const auto & metric = *handler_metrics[idx];
+          visitor(p_handler_id, metric, metric.Stats(handler_contexts[idx]));
+        }
+      });
+    }
+
+    [[nodiscard]]
+    constexpr size_type NumShards() const noexcept
+    {
+      return m_shards.size();
+    }
+
+  private:
+    struct ShardEvent
+    {
+        yy_data::observer_ptr<const Metrics> metrics{};
+        yy_data::observer_ptr<MetricContexts> contexts{};
+        MetricEvent event{};
+    };
+
+    using ShardEvents = yy_quad::simple_vector<ShardEvent>;
+
+    struct Shard
+    {
+        ShardEvents events{};
+        MetricDataVector metric_data{};
+        std::exception_ptr error{};
+    };
+
+    // contexts parallel metrics and are only used by shard.
+    struct Handler
+    {
+        size_type shard = 0;
+        yy_data::observer_ptr<const Metrics> metrics{};
+        yy_data::observer_ptr<MetricContexts> contexts{};
+    };
+
+    using Shards = yy_quad::simple_vector<Shard>;
+    using Handlers = yy_data::flat_map<std::string, Handler>;
+    using Workers = yy_quad::simple_vector<std::jthread>;
+
+    void Work(size_type p_shard_idx) noexcept;
+    void Stop() noexcept;
+
+    MetricsMap m_metrics{};
+    MetricsContextMap m_contexts{};
+    Handlers m_handlers{};
+    Shards m_shards{};
+    std::barrier<> m_start;
+    std::barrier<> m_done;
+    std::atomic<bool> m_stop{false};
+    Workers m_workers{};
+};
+
+} // namespace yafiyogi::yy_values
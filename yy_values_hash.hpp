@@ -0,0 +1,73 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace yafiyogi::yy_values {
+namespace hash_detail {
+
+inline constexpr uint64_t fnv_offset = 0xcbf29ce484222325ULL;
+inline constexpr uint64_t fnv_prime = 0x100000001b3ULL;
+inline constexpr uint64_t golden_ratio = 0x9e3779b97f4a7c15ULL;
+
+} // namespace hash_detail
+
+// splitmix64 finaliser, spreads every input bit over the result.
+constexpr uint64_t hash_mix(uint64_t p_value) noexcept
+{
+  p_value ^= p_value >> 30;
+  p_value *= 0xbf58476d1ce4e5b9ULL;
+  p_value ^= p_value >> 27;
+  p_value *= 0x94d049bb133111ebULL;
+  p_value ^= p_value >> 31;
+
+  return p_value;
+}
+
+// constexpr so hashes computed at compile time and run time agree.
+constexpr uint64_t hash_string(std::string_view p_str) noexcept
+{
+  uint64_t l_hash = hash_detail::fnv_offset;
+
+  for(const auto ch : p_str)
+  {
+    l_hash ^= static_cast<uint8_t>(ch);
+    l_hash *= hash_detail::fnv_prime;
+  }
+
+  return hash_mix(l_hash);
+}
+
+constexpr uint64_t hash_combine(uint64_t p_seed,
+                                uint64_t p_value) noexcept
+{
+  return hash_mix(p_seed ^ (p_value + hash_detail::golden_ratio + (p_seed << 6) + (p_seed >> 2)));
+}
+
+} // namespace yafiyogi::yy_values
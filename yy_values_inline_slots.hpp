@@ -0,0 +1,192 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+namespace yafiyogi::yy_values {
+
+// Contiguous slots with the first Capacity kept inside the object.
+// Growing past Capacity moves every slot to the heap. Slots are never
+// destroyed by shrinking, so the owner can reuse their buffers; only
+// clear() releases them.
+template<typename T,
+         size_type Capacity>
+class InlineSlots final
+{
+  public:
+    using value_type = T;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    static constexpr size_type inline_capacity = Capacity;
+
+    constexpr InlineSlots() noexcept = default;
+    constexpr InlineSlots(const InlineSlots & p_other):
+      m_inline(p_other.m_inline),
+      m_heap(p_other.m_heap),
+      m_size(p_other.m_size)
+    {
+    }
+
+    constexpr InlineSlots(InlineSlots && p_other) noexcept:
+      m_inline(std::move(p_other.m_inline)),
+      m_heap(std::move(p_other.m_heap)),
+      m_size(p_other.m_size)
+    {
+      p_other.m_size = 0;
+    }
+
+    constexpr InlineSlots & operator=(const InlineSlots & p_other)
+    {
+      if(this != &p_other)
+      {
+        m_inline = p_other.m_inline;
+        m_heap = p_other.m_heap;
+        m_size = p_other.m_size;
+      }
+      return *this;
+    }
+
+    constexpr InlineSlots & operator=(InlineSlots && p_other) noexcept
+    {
+      if(this != &p_other)
+      {
+        m_inline = std::move(p_other.m_inline);
+        m_heap = std::move(p_other.m_heap);
+        m_size = p_other.m_size;
+        p_other.m_size = 0;
+      }
+      return *this;
+    }
+
+    [[nodiscard]]
+    constexpr bool spilled() const noexcept
+    {
+      return m_size > Capacity;
+    }
+
+    [[nodiscard]]
+    constexpr T * data() noexcept
+    {
+      return spilled() ? m_heap.data() : m_inline.data();
+    }
+
+    [[nodiscard]]
+    constexpr const T * data() const noexcept
+    {
+      return spilled() ? m_heap.data() : m_inline.data();
+    }
+
+    [[nodiscard]]
+    constexpr size_type size() const noexcept
+    {
+      return m_size;
+    }
+
+    constexpr iterator begin() noexcept
+    {
+      return data();
+    }
+
+    constexpr iterator end() noexcept
+    {
+      return data() + static_cast<std::ptrdiff_t>(m_size);
+    }
+
+    constexpr const_iterator begin() const noexcept
+    {
+      return data();
+    }
+
+    constexpr const_iterator end() const noexcept
+    {
+      return data() + static_cast<std::ptrdiff_t>(m_size);
+    }
+
+    constexpr T & operator[](size_type p_idx) noexcept
+    {
+      return data()[p_idx];
+    }
+
+    constexpr const T & operator[](size_type p_idx) const noexcept
+    {
+      return data()[p_idx];
+    }
+
+    void reserve(size_type p_capacity)
+    {
+      if(p_capacity > Capacity)
+      {
+        m_heap.reserve(p_capacity);
+      }
+    }
+
+    // Adds a slot. An inline slot keeps whatever it held before.
+    T & add_slot()
+    {
+      if(m_size < Capacity)
+      {
+        return m_inline[m_size++];
+      }
+
+      if(m_size == Capacity)
+      {
+        m_heap.reserve(Capacity * 2);
+        for(auto & slot : m_inline)
+        {
+          m_heap.emplace_back(std::move(slot));
+        }
+      }
+
+      m_heap.emplace_back();
+      ++m_size;
+
+      return m_heap[m_size - 1];
+    }
+
+    // Releases every slot.
+    constexpr void clear() noexcept
+    {
+      std::ranges::fill(m_inline, T{});
+      m_heap.clear();
+      m_size = 0;
+    }
+
+  private:
+    std::array<T, Capacity> m_inline{};
+    yy_quad::simple_vector<T> m_heap{};
+    size_type m_size = 0;
+};
+
+} // namespace yafiyogi::yy_values
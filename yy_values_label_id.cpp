@@ -0,0 +1,201 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "yy_cpp/yy_flat_map.h"
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_values_metric_labels.hpp"
+
+#include "yy_values_label_id.hpp"
+
+namespace yafiyogi::yy_values {
+namespace {
+
+// Readers load the current table without locking. Adding names copies
+// the table and publishes the copy; replaced tables are kept, as a
+// reader may still hold one, and names are only added at
+// configuration time so there are few of them.
+class LabelNames final
+{
+  public:
+    LabelNames()
+    {
+      const std::array l_labels{g_label_location, g_label_topic};
+
+      add(l_labels);
+    }
+
+    LabelNames(const LabelNames &) = delete;
+    LabelNames(LabelNames &&) = delete;
+
+    LabelNames & operator=(const LabelNames &) = delete;
+    LabelNames & operator=(LabelNames &&) = delete;
+
+    [[nodiscard]]
+    LabelId intern(std::string_view p_label)
+    {
+      if(auto label_id = find(p_label);
+         !label_id.empty())
+      {
+        return label_id;
+      }
+
+      std::unique_lock lck{m_mtx};
+      add(std::span{&p_label, 1});
+
+      return find(p_label);
+    }
+
+    void intern(std::span<const std::string_view> p_labels)
+    {
+      std::unique_lock lck{m_mtx};
+
+      add(p_labels);
+    }
+
+    [[nodiscard]]
+    LabelId find(std::string_view p_label) const noexcept
+    {
+      return find(*m_table.load(std::memory_order_acquire), p_label);
+    }
+
+    [[nodiscard]]
+    std::string_view name(LabelId::id_type p_id) const noexcept
+    {
+      const auto & l_names = m_table.load(std::memory_order_acquire)->names;
+
+      return (p_id < l_names.size()) ? l_names[p_id] : std::string_view{};
+    }
+
+  private:
+    using Names = yy_quad::simple_vector<std::string_view>;
+    using NameIds = yy_data::flat_map<std::string_view, LabelId::id_type>;
+
+    struct Table
+    {
+        Names names{};
+        NameIds ids{};
+    };
+
+    using TablePtr = std::unique_ptr<const Table>;
+
+    [[nodiscard]]
+    static LabelId find(const Table & p_table,
+                        std::string_view p_label) noexcept
+    {
+      LabelId label_id{};
+
+      auto do_find = [&label_id](auto p_id, auto) {
+        label_id = LabelId{*p_id};
+      };
+
+      std::ignore = p_table.ids.find_value(do_find, p_label);
+
+      return label_id;
+    }
+
+    // Called with m_mtx held, or from the constructor.
+    void add(std::span<const std::string_view> p_labels)
+    {
+      const Table * l_current = m_table.load(std::memory_order_relaxed);
+      std::unique_ptr<Table> l_next{};
+
+      for(const auto label : p_labels)
+      {
+        if(((nullptr != l_current) && !find(*l_current, label).empty())
+           || (l_next && !find(*l_next, label).empty()))
+        {
+          continue;
+        }
+
+        if(!l_next)
+        {
+          l_next = (nullptr != l_current) ? std::make_unique<Table>(*l_current) : std::make_unique<Table>();
+        }
+
+        auto id = static_cast<LabelId::id_type>(l_next->names.size());
+        // std::deque never moves its elements, so the views stay valid.
+        std::string_view name{m_strings.emplace_back(label)};
+
+        l_next->names.emplace_back(name);
+        l_next->ids.emplace(name, id);
+      }
+
+      if(l_next)
+      {
+        const Table * l_published = l_next.get();
+
+        m_tables.emplace_back(std::move(l_next));
+        m_table.store(l_published, std::memory_order_release);
+      }
+    }
+
+    std::mutex m_mtx{};
+    std::deque<std::string> m_strings{};
+    std::deque<TablePtr> m_tables{};
+    std::atomic<const Table *> m_table{nullptr};
+};
+
+LabelNames & label_names()
+{
+  static LabelNames names{};
+
+  return names;
+}
+
+} // anonymous namespace
+
+std::string_view LabelId::Name() const noexcept
+{
+  return label_names().name(m_id);
+}
+
+LabelId intern_label(std::string_view p_label)
+{
+  return label_names().intern(p_label);
+}
+
+void intern_labels(std::span<const std::string_view> p_labels)
+{
+  label_names().intern(p_labels);
+}
+
+LabelId find_label(std::string_view p_label) noexcept
+{
+  return label_names().find(p_label);
+}
+
+} // namespace yafiyogi::yy_values
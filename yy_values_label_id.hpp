@@ -0,0 +1,122 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string_view>
+
+namespace yafiyogi::yy_values {
+
+// Index into the process wide label name table. Only the id is
+// stored; Name() looks it up.
+class LabelId final
+{
+  public:
+    using id_type = uint32_t;
+    static constexpr id_type no_id = std::numeric_limits<id_type>::max();
+
+    // Use intern_label() to obtain ids for runtime label names.
+    constexpr explicit LabelId(id_type p_id) noexcept:
+      m_id(p_id)
+    {
+    }
+
+    constexpr LabelId() noexcept = default;
+    constexpr LabelId(const LabelId &) noexcept = default;
+    constexpr LabelId(LabelId &&) noexcept = default;
+
+    constexpr LabelId & operator=(const LabelId &) noexcept = default;
+    constexpr LabelId & operator=(LabelId &&) noexcept = default;
+
+    constexpr bool operator<(const LabelId & p_other) const noexcept
+    {
+      return m_id < p_other.m_id;
+    }
+
+    constexpr bool operator==(const LabelId & p_other) const noexcept
+    {
+      return m_id == p_other.m_id;
+    }
+
+    constexpr int compare(const LabelId & p_other) const noexcept
+    {
+      if(m_id == p_other.m_id)
+      {
+        return 0;
+      }
+
+      return m_id < p_other.m_id ? -1 : 1;
+    }
+
+    [[nodiscard]]
+    constexpr id_type Id() const noexcept
+    {
+      return m_id;
+    }
+
+    // Lock free. Empty for an empty LabelId.
+    [[nodiscard]]
+    std::string_view Name() const noexcept;
+
+    [[nodiscard]]
+    constexpr bool empty() const noexcept
+    {
+      return no_id == m_id;
+    }
+
+  private:
+    id_type m_id = no_id;
+};
+
+static_assert(sizeof(LabelId) == sizeof(LabelId::id_type));
+
+namespace label_id_detail {
+
+inline constexpr LabelId::id_type location_id = 0;
+inline constexpr LabelId::id_type topic_id = 1;
+
+} // namespace label_id_detail
+
+// Process wide label name table. Names are never removed, so
+// LabelId::Name() stays valid for the life of the process.
+//
+// Lookups (find_label(), Name(), and intern_label() of a known name)
+// are lock free. Adding names takes a lock and republishes the table,
+// so new names should be interned at configuration time, in batches
+// where possible.
+[[nodiscard]]
+LabelId intern_label(std::string_view p_label);
+
+void intern_labels(std::span<const std::string_view> p_labels);
+
+// Returns an empty LabelId if p_label has not been interned.
+[[nodiscard]]
+LabelId find_label(std::string_view p_label) noexcept;
+
+} // namespace yafiyogi::yy_values
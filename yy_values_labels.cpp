@@ -24,57 +24,223 @@
 
 */
 
+#include <algorithm>
+#include <functional>
 #include <string>
 
 #include "yy_values_labels.hpp"
 
 namespace yafiyogi::yy_values {
 
-const std::string g_empty_str{};
-
-Labels::Labels(size_type p_capacity) noexcept:
-  m_labels(p_capacity)
+Labels::Labels(size_type p_capacity) noexcept
 {
+  m_labels.reserve(p_capacity);
 }
 
 void Labels::clear() noexcept
 {
-  m_labels.clear();
+  clear(yy_data::ClearAction::Keep);
 }
 
 void Labels::clear(yy_data::ClearAction p_clear_action) noexcept
 {
-  m_labels.clear(p_clear_action);
+  if(yy_data::ClearAction::Keep != p_clear_action)
+  {
+    m_labels.clear();
+    m_values = std::string{};
+  }
+  m_values.clear();
+  m_size = 0;
+  m_garbage = 0;
+  m_hash = 0;
+}
+
+Labels::find_result Labels::find_pos(LabelId p_label) const noexcept
+{
+  auto begin = m_labels.begin();
+  auto end = begin + static_cast<std::ptrdiff_t>(m_size);
+  auto iter = std::lower_bound(begin, end, p_label,
+                               [](const Label & p_entry, LabelId p_key) {
+                                 return p_entry.label < p_key;
+                               });
+
+  return find_result{static_cast<size_type>(iter - begin),
+                     (end != iter) && (iter->label == p_label)};
+}
+
+Labels::Label & Labels::slot(LabelId p_label)
+{
+  auto [pos, found] = find_pos(p_label);
+
+  if(found)
+  {
+    auto & l_label = m_labels[pos];
+    m_hash ^= l_label.hash;
+
+    return l_label;
+  }
+
+  if(m_size == m_labels.size())
+  {
+    m_labels.add_slot();
+  }
+
+  // Move the first spare slot into position.
+  auto begin = m_labels.begin();
+  std::rotate(begin + static_cast<std::ptrdiff_t>(pos),
+              begin + static_cast<std::ptrdiff_t>(m_size),
+              begin + static_cast<std::ptrdiff_t>(m_size + 1));
+  ++m_size;
+
+  auto & l_label = m_labels[pos];
+  l_label = Label{p_label, 0, 0, 0};
+
+  return l_label;
 }
 
-std::string & Labels::set_label(std::string_view p_label,
-                                std::string_view p_value)
+bool Labels::in_values(std::string_view p_value) const noexcept
 {
-  auto [pos, _] = m_labels.emplace_or_assign(std::string{p_label},
-                                             std::string{p_value});
+  const auto * l_begin = m_values.data();
+  const auto * l_end = l_begin + m_values.size();
 
-  return *m_labels.value(pos);
+  return std::less_equal<>{}(l_begin, p_value.data())
+    && std::less<>{}(p_value.data(), l_end);
 }
 
-const std::string & Labels::get_label(const std::string_view p_label) const noexcept
+size_type Labels::append(std::string_view p_value)
 {
-  LabelStore::const_value_ptr label{&g_empty_str};
+  const size_type l_size = m_values.size() + p_value.size();
+
+  if(l_size > m_values.capacity())
+  {
+    if(in_values(p_value))
+    {
+      // Growing moves the buffer p_value points into.
+      const auto l_pos = static_cast<size_type>(p_value.data() - m_values.data());
 
-  auto do_get_value = [&label](auto p_visitor_label, auto) {
-    if(nullptr != p_visitor_label)
+      m_values.reserve(l_size);
+      p_value = std::string_view{m_values.data() + l_pos, p_value.size()};
+    }
+    else if(0 != m_garbage)
     {
-      label = p_visitor_label;
+      compact();
     }
-  };
+  }
 
-  std::ignore = get_label(do_get_value, p_label);
+  const size_type l_offset = m_values.size();
+  m_values.append(p_value);
 
-  return *label;
+  return l_offset;
+}
+
+void Labels::compact() noexcept
+{
+  // Live values never overlap, so sliding them down in buffer order
+  // never overwrites a value not yet moved.
+  uint32_t l_end = 0;
+
+  while(true)
+  {
+    Label * l_next = nullptr;
+
+    for(size_type idx = 0; idx < m_size; ++idx)
+    {
+      auto & l_label = m_labels[idx];
+
+      if((0 != l_label.size)
+         && (l_label.offset >= l_end)
+         && ((nullptr == l_next) || (l_label.offset < l_next->offset)))
+      {
+        l_next = &l_label;
+      }
+    }
+
+    if(nullptr == l_next)
+    {
+      break;
+    }
+
+    std::char_traits<char>::move(m_values.data() + l_end,
+                                 m_values.data() + l_next->offset,
+                                 l_next->size);
+    l_next->offset = l_end;
+    l_end += l_next->size;
+  }
+
+  for(size_type idx = 0; idx < m_size; ++idx)
+  {
+    if(auto & l_label = m_labels[idx];
+       0 == l_label.size)
+    {
+      l_label.offset = 0;
+    }
+  }
+
+  m_values.resize(l_end);
+  m_garbage = 0;
+}
+
+std::string_view Labels::set_label(LabelId p_label,
+                                   std::string_view p_value)
+{
+  auto & l_label = slot(p_label);
+
+  if(p_value.size() <= l_label.size)
+  {
+    // Overwrite in place; p_value may be this label's own value.
+    std::char_traits<char>::move(m_values.data() + l_label.offset,
+                                 p_value.data(),
+                                 p_value.size());
+    m_garbage += l_label.size - p_value.size();
+  }
+  else
+  {
+    // Drop the old value first, so append() may compact it away.
+    m_garbage += l_label.size;
+    l_label.size = 0;
+    l_label.offset = static_cast<uint32_t>(append(p_value));
+  }
+  l_label.size = static_cast<uint32_t>(p_value.size());
+
+  return update_hash(l_label);
+}
+
+std::string_view Labels::get_label(LabelId p_label) const noexcept
+{
+  if(auto [pos, found] = find_pos(p_label);
+     found)
+  {
+    return value(m_labels[pos]);
+  }
+
+  return std::string_view{};
+}
+
+std::string_view Labels::get_label(const std::string_view p_label) const noexcept
+{
+  return get_label(find_label(p_label));
+}
+
+void Labels::erase(LabelId p_label)
+{
+  if(auto [pos, found] = find_pos(p_label);
+     found)
+  {
+    m_hash ^= m_labels[pos].hash;
+    m_garbage += m_labels[pos].size;
+
+    // Move the erased slot to the spare area for reuse.
+    auto begin = m_labels.begin();
+    std::rotate(begin + static_cast<std::ptrdiff_t>(pos),
+                begin + static_cast<std::ptrdiff_t>(pos + 1),
+                begin + static_cast<std::ptrdiff_t>(m_size));
+    --m_size;
+  }
 }
 
 void Labels::erase(const std::string_view p_label)
 {
-  m_labels.erase(p_label);
+  erase(find_label(p_label));
 }
 
 } // namespace yafiyogi::yy_values
@@ -26,72 +26,225 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <string_view>
+#include <utility>
 
-#include "yy_cpp/yy_flat_map.h"
+#include "yy_cpp/yy_clear_action.h"
+#include "yy_cpp/yy_types.hpp"
+
+#include "yy_values_hash.hpp"
+#include "yy_values_inline_slots.hpp"
+#include "yy_values_label_id.hpp"
 
 namespace yafiyogi::yy_values {
+namespace labels_detail {
+
+// Most metrics carry this many labels or fewer, so their Labels
+// never allocate a slot store.
+inline constexpr size_type inline_capacity = 4;
+
+} // namespace labels_detail
 
 class Labels final
 {
   public:
-    using LabelStore = yy_data::flat_map<std::string,
-                                         std::string,
-                                         yy_data::ClearAction::Keep,
-                                         yy_data::ClearAction::Keep>;
+    // Values are packed into one buffer; a slot holds the label id
+    // and where its value lies in the buffer.
+    struct Label
+    {
+        LabelId label{};
+        uint32_t offset = 0;
+        uint32_t size = 0;
+        uint64_t hash = 0;
+    };
+
+    // Entries past m_size are spare slots kept from earlier events.
+    // The first labels_detail::inline_capacity slots are stored in
+    // the object. Both the slots and the value buffer keep their
+    // capacity across clear(ClearAction::Keep), so a steady stream of
+    // similar label sets does not allocate.
+    using LabelStore = InlineSlots<Label, labels_detail::inline_capacity>;
 
     Labels(size_type capacity) noexcept;
     constexpr Labels() noexcept = default;
     constexpr Labels(const Labels &) noexcept = default;
-    constexpr Labels(Labels &&) noexcept = default;
+    constexpr Labels(Labels && p_other) noexcept:
+      m_labels(std::move(p_other.m_labels)),
+      m_values(std::move(p_other.m_values)),
+      m_size(p_other.m_size),
+      m_garbage(p_other.m_garbage),
+      m_hash(p_other.m_hash)
+    {
+      p_other.m_size = 0;
+      p_other.m_garbage = 0;
+      p_other.m_hash = 0;
+    }
 
     constexpr Labels & operator=(const Labels &) noexcept = default;
-    constexpr Labels & operator=(Labels &&) noexcept = default;
+    constexpr Labels & operator=(Labels && p_other) noexcept
+    {
+      if(this != &p_other)
+      {
+        m_labels = std::move(p_other.m_labels);
+        m_values = std::move(p_other.m_values);
+        m_size = p_other.m_size;
+        m_garbage = p_other.m_garbage;
+        m_hash = p_other.m_hash;
+        p_other.m_size = 0;
+        p_other.m_garbage = 0;
+        p_other.m_hash = 0;
+      }
+      return *this;
+    }
 
     void clear() noexcept;
     void clear(yy_data::ClearAction p_clear_action) noexcept;
-    std::string & set_label(std::string_view p_label,
-                            std::string_view p_value);
+
+    // Returned views, and views from get_label() and visit(), are
+    // valid until the next change to this set.
+    std::string_view set_label(LabelId p_label,
+                               std::string_view p_value);
+
+    // Adds or updates p_label with the value p_writer appends to the
+    // string it is given. p_writer must only append to it.
+    template<typename Writer>
+    std::string_view assign_label(LabelId p_label,
+                                  Writer && p_writer)
+    {
+      if(0 != m_garbage)
+      {
+        compact();
+      }
+
+      const size_type l_offset = m_values.size();
+      p_writer(m_values);
+
+      auto & l_label = slot(p_label);
+      m_garbage += l_label.size;
+      l_label.offset = static_cast<uint32_t>(l_offset);
+      l_label.size = static_cast<uint32_t>(m_values.size() - l_offset);
+
+      return update_hash(l_label);
+    }
 
     [[nodiscard]]
-    const std::string & get_label(const std::string_view p_label) const noexcept;
+    std::string_view get_label(LabelId p_label) const noexcept;
+    [[nodiscard]]
+    std::string_view get_label(const std::string_view p_label) const noexcept;
+
+    template<typename Visitor>
+    [[nodiscard]]
+    bool get_label(Visitor && visitor,
+                   LabelId p_label) const noexcept
+    {
+      if(auto [pos, found] = find_pos(p_label);
+         found)
+      {
+        const std::string_view l_value{value(m_labels[pos])};
+
+        visitor(&l_value, pos);
+        return true;
+      }
+
+      return false;
+    }
 
     template<typename Visitor>
     [[nodiscard]]
     bool get_label(Visitor && visitor,
                    const std::string_view p_label) const noexcept
     {
-      return m_labels.find_value(std::forward<Visitor>(visitor), p_label).found;
+      return get_label(std::forward<Visitor>(visitor), find_label(p_label));
     }
 
+    void erase(LabelId p_label);
     void erase(const std::string_view p_label);
 
     [[nodiscard]]
     constexpr size_type size() const noexcept
     {
-      return m_labels.size();
+      return m_size;
     }
 
     constexpr bool operator<(const Labels & p_other) const noexcept
     {
-      return m_labels.compare(p_other.m_labels) < 0;
+      return compare(p_other) < 0;
     }
 
     constexpr bool operator==(const Labels & p_other) const noexcept
     {
-      return m_labels.compare(p_other.m_labels) == 0;
+      return (m_hash == p_other.m_hash) && (compare(p_other) == 0);
+    }
+
+    // Order independent hash of the label set, updated incrementally
+    // by set_label(), assign_label(), erase() and clear().
+    [[nodiscard]]
+    constexpr uint64_t Hash() const noexcept
+    {
+      return m_hash;
+    }
+
+    static constexpr uint64_t hash(LabelId p_label,
+                                   std::string_view p_value) noexcept
+    {
+      return hash_combine(hash_mix(p_label.Id()), hash_string(p_value));
     }
 
     constexpr int compare(const Labels & p_other) const noexcept
     {
-      return m_labels.compare(p_other.m_labels);
+      const size_type l_size = std::min(m_size, p_other.m_size);
+
+      for(size_type idx = 0; idx < l_size; ++idx)
+      {
+        const auto & l_label = m_labels[idx];
+        const auto & l_other = p_other.m_labels[idx];
+
+        if(int comp = l_label.label.compare(l_other.label);
+           0 != comp)
+        {
+          return comp;
+        }
+
+        if(int comp = value(l_label).compare(p_other.value(l_other));
+           0 != comp)
+        {
+          return comp;
+        }
+      }
+
+      if(m_size == p_other.m_size)
+      {
+        return 0;
+      }
+
+      return m_size < p_other.m_size ? -1 : 1;
     }
 
     template<typename Visitor>
     void visit(Visitor && visitor) const
     {
-      m_labels.visit(std::forward<Visitor>(visitor));
+      for(size_type idx = 0; idx < m_size; ++idx)
+      {
+        const auto & l_label = m_labels[idx];
+
+        visitor(l_label.label.Name(), value(l_label));
+      }
+    }
+
+    // As visit(), passing the LabelId rather than its name.
+    template<typename Visitor>
+    void visit_ids(Visitor && visitor) const
+    {
+      for(size_type idx = 0; idx < m_size; ++idx)
+      {
+        const auto & l_label = m_labels[idx];
+
+        visitor(l_label.label, value(l_label));
+      }
     }
 
     constexpr void swap(Labels & p_other) noexcept
@@ -99,6 +252,10 @@ class Labels final
       if(this != &p_other)
       {
         std::swap(m_labels, p_other.m_labels);
+        m_values.swap(p_other.m_values);
+        std::swap(m_size, p_other.m_size);
+        std::swap(m_garbage, p_other.m_garbage);
+        std::swap(m_hash, p_other.m_hash);
       }
     }
 
@@ -108,7 +265,60 @@ class Labels final
     }
 
   private:
+    struct find_result
+    {
+        size_type pos = 0;
+        bool found = false;
+    };
+
+    [[nodiscard]]
+    find_result find_pos(LabelId p_label) const noexcept;
+
+    // Finds or inserts p_label, removing its old value from m_hash.
+    // An inserted slot has an empty value.
+    [[nodiscard]]
+    Label & slot(LabelId p_label);
+
+    [[nodiscard]]
+    constexpr std::string_view value(const Label & p_label) const noexcept
+    {
+      return std::string_view{m_values.data() + p_label.offset, p_label.size};
+    }
+
+    std::string_view update_hash(Label & p_label) noexcept
+    {
+      const auto l_value = value(p_label);
+
+      p_label.hash = hash(p_label.label, l_value);
+      m_hash ^= p_label.hash;
+
+      return l_value;
+    }
+
+    [[nodiscard]]
+    bool in_values(std::string_view p_value) const noexcept;
+
+    // Appends p_value to m_values, returning its offset.
+    size_type append(std::string_view p_value);
+
+    // Moves live values to the front of m_values, dropping the bytes
+    // of erased and overwritten values.
+    void compact() noexcept;
+
     LabelStore m_labels{};
+    std::string m_values{};
+    size_type m_size = 0;
+    size_type m_garbage = 0;
+    uint64_t m_hash = 0;
 };
 
 } // namespace yafiyogi::yy_values
+
+template<>
+struct std::hash<yafiyogi::yy_values::Labels>
+{
+    constexpr std::size_t operator()(const yafiyogi::yy_values::Labels & p_labels) const noexcept
+    {
+      return static_cast<std::size_t>(p_labels.Hash());
+    }
+};
@@ -24,6 +24,8 @@
 
 */
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <string_view>
 
@@ -34,8 +36,11 @@
 #include "yy_values_metric_id_fmt.hpp"
 
 #include "yy_label_action.hpp"
+#include "yy_label_action_program.hpp"
+#include "yy_value_parse.hpp"
 #include "yy_values_labels.hpp"
 #include "yy_values_metric_labels.hpp"
+#include "yy_values_metric_spec.hpp"
 
 #include "yy_values_metric.hpp"
 
@@ -43,18 +48,38 @@ namespace yafiyogi::yy_values {
 
 using namespace std::string_view_literals;
 
+namespace {
+
+const yy_mqtt::TopicLevelsView g_no_levels{};
+
+// An event without levels is processed as a topic with none.
+const yy_mqtt::TopicLevelsView & event_levels(const MetricEvent & p_event) noexcept
+{
+  return p_event.levels ? *p_event.levels : g_no_levels;
+}
+
+} // anonymous namespace
+
 Metric::Metric(MetricId && p_id,
                std::string && p_property,
                LabelActions && p_label_actions,
                ValueActions && p_value_actions,
-               LabelActions && p_metric_property_actions):
+               LabelActions && p_metric_property_actions,
+               DedupConfig p_dedup,
+               RateConfig p_rate,
+               size_type p_cache_capacity,
+               MetricSpecPtr p_spec):
   m_id(std::move(p_id)),
-  m_metric_data(m_id),
   m_property(std::move(p_property)),
-  m_label_actions(std::move(p_label_actions)),
+  m_label_actions(compile_label_actions(p_label_actions)),
   m_value_actions(std::move(p_value_actions)),
-  m_metric_property_actions(std::move(p_metric_property_actions)),
-  m_metric_properties(m_metric_property_actions.size())
+  m_metric_property_actions(compile_label_actions(p_metric_property_actions)),
+  m_dedup(p_dedup),
+  m_rate(p_rate),
+  m_cache_capacity(p_cache_capacity),
+  m_fingerprint(p_spec ? p_spec->fingerprint : 0),
+  m_spec(std::move(p_spec)),
+  m_context(CreateContext())
 {
 }
 
@@ -68,6 +93,84 @@ const std::string & Metric::Property() const noexcept
   return m_property;
 }
 
+MetricContext Metric::CreateContext() const
+{
+  MetricContext context{};
+
+  context.m_metric_data.Id(m_id);
+  context.m_metric_properties = Labels{m_metric_property_actions.size()};
+  context.m_property_caches = m_metric_property_actions.create_caches(m_cache_capacity);
+  context.m_label_caches = m_label_actions.create_caches(m_cache_capacity);
+
+  if(RateMode::Off != m_rate.mode)
+  {
+    context.m_rate_cache = RateCache{m_rate.series, m_rate.expiry};
+  }
+
+  if constexpr(g_stats_enabled)
+  {
+    context.m_stats.property_actions = m_metric_property_actions.create_stats();
+    context.m_stats.label_actions = m_label_actions.create_stats();
+    context.m_stats.value_actions = ActionStatsVector(m_value_actions.size());
+  }
+
+  return context;
+}
+
+MetricStatsSnapshot Metric::Stats(const MetricContext & p_context) const
+{
+  const auto & l_stats = p_context.m_stats;
+  MetricStatsSnapshot snapshot{};
+
+  snapshot.events = l_stats.events.value();
+  snapshot.unchanged = l_stats.unchanged.value();
+  snapshot.rate_resets = l_stats.rate_resets.value();
+  snapshot.rate_unparsed = l_stats.rate_unparsed.value();
+  snapshot.rate_stale = l_stats.rate_stale.value();
+  snapshot.event_latency = l_stats.event_latency.snapshot();
+  snapshot.property_actions = m_metric_property_actions.snapshot_stats(l_stats.property_actions);
+  snapshot.label_actions = m_label_actions.snapshot_stats(l_stats.label_actions);
+
+  snapshot.value_actions.reserve(m_value_actions.size());
+  for(size_type idx = 0; idx < m_value_actions.size(); ++idx)
+  {
+    ActionSnapshot action{m_value_actions[idx]->Name()};
+
+    if(idx < l_stats.value_actions.size())
+    {
+      action.calls = l_stats.value_actions[idx].calls.value();
+      action.misses = l_stats.value_actions[idx].misses.value();
+    }
+
+    snapshot.value_actions.emplace_back(action);
+  }
+
+  return snapshot;
+}
+
+MetricStatsSnapshot Metric::Stats() const
+{
+  return Stats(m_context);
+}
+
+void Metric::Event(MetricContext & p_context,
+                   std::string_view p_value,
+                   const std::string_view p_topic,
+                   const yy_mqtt::TopicLevelsView & p_levels,
+                   const timestamp_type p_timestamp,
+                   ValueType p_value_type,
+                   yy_values::MetricDataVectorPtr p_metric_data) const
+{
+  ProcessEvent(p_context,
+               p_value,
+               p_topic,
+               p_levels,
+               p_timestamp,
+               p_value_type,
+               spdlog::level::debug >= spdlog::get_level(),
+               p_metric_data);
+}
+
 void Metric::Event(std::string_view p_value,
                    const std::string_view p_topic,
                    const yy_mqtt::TopicLevelsView & p_levels,
@@ -75,49 +178,290 @@ void Metric::Event(std::string_view p_value,
                    ValueType p_value_type,
                    yy_values::MetricDataVectorPtr p_metric_data)
 {
-  spdlog::debug("    [{}] property=[{}] [{}]"sv,
-                Id().Name(),
-                m_property,
-                p_value);
+  Event(m_context,
+        p_value,
+        p_topic,
+        p_levels,
+        p_timestamp,
+        p_value_type,
+        p_metric_data);
+}
+
+const PropertyValue * Metric::SelectValue(const MetricEvent & p_event,
+                                          PropertyValue & p_single) const noexcept
+{
+  if(p_event.properties.empty())
+  {
+    p_single = PropertyValue{m_property, p_event.value, p_event.value_type};
+    return &p_single;
+  }
+
+  for(const auto & property : p_event.properties)
+  {
+    if(property.property == m_property)
+    {
+      return &property;
+    }
+  }
+
+  return nullptr;
+}
+
+bool Metric::Event(MetricContext & p_context,
+                   const MetricEvent & p_event,
+                   yy_values::MetricDataVectorPtr p_metric_data) const
+{
+  PropertyValue single{};
+  const auto * property = SelectValue(p_event, single);
+
+  if(nullptr == property)
+  {
+    return false;
+  }
+
+  ProcessEvent(p_context,
+               property->value,
+               p_event.topic,
+               event_levels(p_event),
+               p_event.timestamp,
+               property->value_type,
+               spdlog::level::debug >= spdlog::get_level(),
+               p_metric_data);
+
+  return true;
+}
+
+bool Metric::Event(const MetricEvent & p_event,
+                   yy_values::MetricDataVectorPtr p_metric_data)
+{
+  return Event(m_context, p_event, p_metric_data);
+}
 
-  m_metric_data.Id(m_id);
-  m_metric_data.Value(p_value);
-  m_metric_data.Type(p_value_type);
-  m_metric_data.Timestamp(p_timestamp);
+void Metric::Events(MetricContext & p_context,
+                    std::span<const MetricEvent> p_events,
+                    yy_values::MetricDataVectorPtr p_metric_data) const
+{
+  const bool is_debug = spdlog::level::debug >= spdlog::get_level();
 
-  m_metric_properties.clear(yy_data::ClearAction::Keep);
-  m_metric_properties.set_label(g_label_topic, std::string{p_topic});
+  // Grow geometrically, so a stream of small batches doesn't
+  // reallocate on every call.
+  if(const size_type l_needed = p_metric_data->size() + p_events.size();
+     l_needed > p_metric_data->capacity())
+  {
+    p_metric_data->reserve(std::max(l_needed, 2 * p_metric_data->capacity()));
+  }
 
-  for(const auto & action : m_metric_property_actions)
+  for(const auto & event : p_events)
   {
-    action->Apply(m_metric_properties, p_levels, m_metric_properties);
+    PropertyValue single{};
+    const auto * property = SelectValue(event, single);
+
+    if(nullptr == property)
+    {
+      continue;
+    }
+
+    ProcessEvent(p_context,
+                 property->value,
+                 event.topic,
+                 event_levels(event),
+                 event.timestamp,
+                 property->value_type,
+                 is_debug,
+                 p_metric_data);
   }
+}
 
-  m_metric_data.Location(m_metric_properties.get_label(g_label_location));
+void Metric::Events(std::span<const MetricEvent> p_events,
+                    yy_values::MetricDataVectorPtr p_metric_data)
+{
+  Events(m_context, p_events, p_metric_data);
+}
+
+void Metric::ProcessEvent(MetricContext & p_context,
+                          std::string_view p_value,
+                          const std::string_view p_topic,
+                          const yy_mqtt::TopicLevelsView & p_levels,
+                          const timestamp_type p_timestamp,
+                          ValueType p_value_type,
+                          bool p_is_debug,
+                          yy_values::MetricDataVectorPtr p_metric_data) const
+{
+  [[maybe_unused]] std::chrono::steady_clock::time_point l_start{};
+  auto & l_stats = p_context.m_stats;
 
-  auto & l_labels = m_metric_data.Labels();
+  if constexpr(g_stats_enabled)
+  {
+    l_start = std::chrono::steady_clock::now();
+  }
+
+  if(p_is_debug)
+  {
+    spdlog::debug("    [{}] property=[{}] [{}]"sv,
+                  Id().Name(),
+                  m_property,
+                  p_value);
+  }
+
+  auto & l_metric_data = p_context.m_metric_data;
+  auto & l_metric_properties = p_context.m_metric_properties;
+
+  l_metric_data.Id(m_id);
+  l_metric_data.Value(p_value);
+  l_metric_data.Type(p_value_type);
+  l_metric_data.Timestamp(p_timestamp);
+
+  // Properties depend only on the topic, so they are reused while
+  // consecutive events arrive on the same topic.
+  if((0 == l_metric_properties.size())
+     || (p_topic != l_metric_properties.get_label(g_label_topic_id)))
+  {
+    l_metric_properties.clear(yy_data::ClearAction::Keep);
+    l_metric_properties.set_label(g_label_topic_id, p_topic);
+
+    m_metric_property_actions.Apply(l_metric_properties,
+                                    p_levels,
+                                    l_metric_properties,
+                                    p_context.m_property_caches,
+                                    l_stats.property_actions);
+  }
+
+  l_metric_data.Location(l_metric_properties.get_label(g_label_location_id));
+
+  auto & l_labels = l_metric_data.Labels();
   l_labels.clear(yy_data::ClearAction::Keep);
-  l_labels.set_label(yy_values::g_label_location, m_metric_data.Id().Location());
-  l_labels.set_label(yy_values::g_label_topic, std::string{p_topic});
-  for(const auto & action : m_label_actions)
+  l_labels.set_label(yy_values::g_label_location_id, l_metric_data.Id().Location());
+  l_labels.set_label(yy_values::g_label_topic_id, p_topic);
+  m_label_actions.Apply(l_metric_properties,
+                        p_levels,
+                        l_labels,
+                        p_context.m_label_caches,
+                        l_stats.label_actions);
+
+  const bool has_value_stats = g_stats_enabled
+                               && (l_stats.value_actions.size() == m_value_actions.size());
+
+  for(size_type idx = 0; idx < m_value_actions.size(); ++idx)
   {
-    action->Apply(m_metric_properties, p_levels, l_labels);
+    const bool applied = m_value_actions[idx]->Apply(l_metric_data, l_metric_data.Type());
+
+    if(has_value_stats)
+    {
+      auto & action_stats = l_stats.value_actions[idx];
+      action_stats.calls.inc();
+      if(!applied)
+      {
+        action_stats.misses.inc();
+      }
+    }
   }
 
-  for(const auto & action : m_value_actions)
+  // Numeric and range value actions leave the value final.
+  if(ValueStatus::Unparsed == l_metric_data.Status())
   {
-    action->Apply(m_metric_data, p_value_type);
+    parse_value(l_metric_data);
   }
 
-  if(spdlog::level::debug >= spdlog::get_level())
+  if(p_is_debug)
   {
-    m_metric_data.Labels().visit([](const auto & label,
+    l_metric_data.Labels().visit([](const auto & label,
                                     const auto & value) {
       spdlog::debug("      - [{}]:[{}]"sv, label, value);
     });
   }
 
-  p_metric_data->swap_data_back(m_metric_data);
+  // A series' first sample has no rate and is not emitted.
+  bool emit = true;
+
+  if(RateMode::Off != m_rate.mode)
+  {
+    switch(p_context.m_rate_cache.Apply(l_metric_data, m_rate.mode))
+    {
+      case RateResult::Ok:
+        break;
+
+      case RateResult::Reset:
+        l_stats.rate_resets.inc();
+        break;
+
+      case RateResult::First:
+        emit = false;
+        break;
+
+      case RateResult::Unparsed:
+        emit = false;
+        l_stats.rate_unparsed.inc();
+        if(p_is_debug)
+        {
+          spdlog::debug("    [{}] rate dropped unparsed value [{}]"sv,
+                        Id().Name(),
+                        l_metric_data.Value());
+        }
+        break;
+
+      case RateResult::Stale:
+        emit = false;
+        l_stats.rate_stale.inc();
+        if(p_is_debug)
+        {
+          spdlog::debug("    [{}] rate dropped sample, timestamp has not advanced"sv,
+                        Id().Name());
+        }
+        break;
+    }
+  }
+
+  if(emit && (DedupMode::Off != m_dedup.mode))
+  {
+    const bool unchanged = p_context.m_series_cache.Unchanged(l_metric_data, m_dedup);
+
+    if(unchanged)
+    {
+      l_stats.unchanged.inc();
+    }
+
+    l_metric_data.Unchanged(unchanged);
+    emit = !unchanged || (DedupMode::Mark == m_dedup.mode);
+  }
+
+  if(emit)
+  {
+    p_metric_data->swap_data_back(l_metric_data);
+  }
+
+  if constexpr(g_stats_enabled)
+  {
+    const auto l_elapsed = std::chrono::steady_clock::now() - l_start;
+
+    l_stats.events.inc();
+    l_stats.event_latency.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(l_elapsed).count()));
+  }
+}
+
+MetricContexts create_contexts(const Metrics & p_metrics)
+{
+  MetricContexts contexts{};
+
+  contexts.reserve(p_metrics.size());
+  for(const auto & metric : p_metrics)
+  {
+    contexts.emplace_back(metric->CreateContext());
+  }
+
+  return contexts;
+}
+
+MetricsContextMap create_contexts(const MetricsMap & p_metrics)
+{
+  MetricsContextMap contexts{};
+
+  contexts.reserve(p_metrics.size());
+  p_metrics.visit([&contexts](const auto & p_handler_id,
+                              const auto & p_handler_metrics) {
+    contexts.emplace(p_handler_id, create_contexts(p_handler_metrics));
+  });
+
+  return contexts;
 }
 
 } // namespace yafiyogi::yy_values
@@ -26,23 +26,61 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include "yy_cpp/yy_types.hpp"
 #include "yy_cpp/yy_vector.h"
 #include "yy_cpp/yy_flat_map.h"
+#include "yy_cpp/yy_observer_ptr.hpp"
 
 #include "yy_mqtt/yy_mqtt_types.h"
 
 #include "yy_label_action.hpp"
+#include "yy_label_action_program.hpp"
+#include "yy_values_metric_context.hpp"
 #include "yy_values_metric_data.hpp"
+#include "yy_values_rate_cache.hpp"
+#include "yy_values_series_cache.hpp"
+#include "yy_values_stats.hpp"
 #include "yy_value_action.hpp"
 #include "yy_value_type.hpp"
 
 namespace yafiyogi::yy_values {
 
+// One named value of a payload carrying several properties.
+struct PropertyValue
+{
+    std::string_view property{};
+    std::string_view value{};
+    ValueType value_type = ValueType::Unknown;
+};
+
+// If properties is empty every Metric takes value, otherwise each
+// Metric takes the value of its own Property() and ignores the event
+// if there is none.
+struct MetricSpec;
+using MetricSpecPtr = std::shared_ptr<const MetricSpec>;
+
+struct MetricEvent
+{
+    std::string_view value{};
+    std::string_view topic{};
+    // Null is treated as a topic with no levels.
+    yy_data::observer_ptr<const yy_mqtt::TopicLevelsView> levels{};
+    timestamp_type timestamp{};
+    ValueType value_type = ValueType::Unknown;
+    std::span<const PropertyValue> properties{};
+};
+
+// Metric configuration is immutable after construction. The const
+// Event() overloads take a caller supplied MetricContext, so one
+// Metric can be shared by several threads. The non-const overloads
+// use a context owned by the Metric.
 class Metric final
 {
   public:
@@ -50,11 +88,15 @@ class Metric final
                     std::string && p_property,
                     LabelActions && p_label_actions,
                     ValueActions && p_value_actions,
-                    LabelActions && p_metric_property_actions);
+                    LabelActions && p_metric_property_actions,
+                    DedupConfig p_dedup = DedupConfig{},
+                    RateConfig p_rate = RateConfig{},
+                    size_type p_cache_capacity = replace_path_cache_detail::default_capacity,
+                    MetricSpecPtr p_spec = MetricSpecPtr{});
 
     constexpr Metric() noexcept = default;
-    constexpr Metric(const Metric &) noexcept = default;
-    constexpr Metric(Metric &&) noexcept = default;
+    Metric(const Metric &) = default;
+    Metric(Metric &&) noexcept = default;
 
     Metric & operator=(const Metric &) noexcept = default;
     Metric & operator=(Metric &&) noexcept = default;
@@ -65,6 +107,76 @@ class Metric final
     [[nodiscard]]
     const std::string & Property() const noexcept;
 
+    [[nodiscard]]
+    constexpr const DedupConfig & Dedup() const noexcept
+    {
+      return m_dedup;
+    }
+
+    [[nodiscard]]
+    constexpr const RateConfig & Rate() const noexcept
+    {
+      return m_rate;
+    }
+
+    // Entries in each replace-path cache of a new context.
+    [[nodiscard]]
+    constexpr size_type CacheCapacity() const noexcept
+    {
+      return m_cache_capacity;
+    }
+
+    // Hash of the configuration this Metric was built from, used to
+    // reuse unchanged Metrics on reload. Zero if unknown.
+    [[nodiscard]]
+    constexpr uint64_t Fingerprint() const noexcept
+    {
+      return m_fingerprint;
+    }
+
+    // The spec this Metric was built from, or nullptr if unknown.
+    [[nodiscard]]
+    const MetricSpec * Spec() const noexcept
+    {
+      return m_spec.get();
+    }
+
+    [[nodiscard]]
+    MetricContext CreateContext() const;
+
+    // Visitor is called with (LabelId target, const ReplacePathCache::Stats &)
+    // for each replace-path property and label action.
+    template<typename Visitor>
+    void VisitCacheStats(const MetricContext & p_context,
+                         Visitor && visitor) const
+    {
+      m_metric_property_actions.visit_cache_stats(p_context.m_property_caches, visitor);
+      m_label_actions.visit_cache_stats(p_context.m_label_caches, visitor);
+    }
+
+    template<typename Visitor>
+    void VisitCacheStats(Visitor && visitor) const
+    {
+      VisitCacheStats(m_context, std::forward<Visitor>(visitor));
+    }
+
+    // Counters are per context. Snapshots may be taken from any
+    // thread while the context is in use; with stats compiled out
+    // only the action names are filled in.
+    [[nodiscard]]
+    MetricStatsSnapshot Stats(const MetricContext & p_context) const;
+
+    [[nodiscard]]
+    MetricStatsSnapshot Stats() const;
+
+    void Event(MetricContext & p_context,
+               std::string_view p_value,
+               const std::string_view p_topic,
+               const yy_mqtt::TopicLevelsView & p_levels,
+               const timestamp_type p_timestamp,
+               ValueType p_value_type,
+               MetricDataVectorPtr p_metric_data) const;
+
     void Event(std::string_view p_value,
                const std::string_view p_topic,
                const yy_mqtt::TopicLevelsView & p_levels,
@@ -72,19 +184,63 @@ class Metric final
                ValueType p_value_type,
                MetricDataVectorPtr p_metric_data);
 
+    // Returns false if p_event has no value for Property().
+    bool Event(MetricContext & p_context,
+               const MetricEvent & p_event,
+               MetricDataVectorPtr p_metric_data) const;
+
+    bool Event(const MetricEvent & p_event,
+               MetricDataVectorPtr p_metric_data);
+
+    // Process p_events in order, appending one MetricData per event
+    // (unless suppressed by deduplication or it has no value for
+    // Property()).
+    void Events(MetricContext & p_context,
+                std::span<const MetricEvent> p_events,
+                MetricDataVectorPtr p_metric_data) const;
+
+    void Events(std::span<const MetricEvent> p_events,
+                MetricDataVectorPtr p_metric_data);
+
   private:
+    [[nodiscard]]
+    const PropertyValue * SelectValue(const MetricEvent & p_event,
+                                      PropertyValue & p_single) const noexcept;
+
+    void ProcessEvent(MetricContext & p_context,
+                      std::string_view p_value,
+                      const std::string_view p_topic,
+                      const yy_mqtt::TopicLevelsView & p_levels,
+                      const timestamp_type p_timestamp,
+                      ValueType p_value_type,
+                      bool p_is_debug,
+                      MetricDataVectorPtr p_metric_data) const;
+
     MetricId m_id{};
-    MetricData m_metric_data{};
     std::string m_property{};
 
-    LabelActions m_label_actions{};
+    LabelActionProgram m_label_actions{};
     ValueActions m_value_actions{};
-    LabelActions m_metric_property_actions{};
-    Labels m_metric_properties{};
+    LabelActionProgram m_metric_property_actions{};
+    DedupConfig m_dedup{};
+    RateConfig m_rate{};
+    size_type m_cache_capacity = replace_path_cache_detail::default_capacity;
+    uint64_t m_fingerprint = 0;
+    MetricSpecPtr m_spec{};
+
+    MetricContext m_context{};
 };
 
 using MetricPtr = std::shared_ptr<Metric>;
 using Metrics = yy_quad::simple_vector<MetricPtr>;
 using MetricsMap = yy_data::flat_map<std::string, Metrics>;
 
+// Contexts parallel to Metrics, for sharing a MetricsMap between
+// threads: each thread creates its own MetricsContextMap.
+using MetricContexts = yy_quad::simple_vector<MetricContext>;
+using MetricsContextMap = yy_data::flat_map<std::string, MetricContexts>;
+
+MetricContexts create_contexts(const Metrics & p_metrics);
+MetricsContextMap create_contexts(const MetricsMap & p_metrics);
+
 } // namespace yafiyogi::yy_values
@@ -0,0 +1,65 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "yy_values_labels.hpp"
+#include "yy_values_metric_data.hpp"
+#include "yy_replace_path_cache.hpp"
+#include "yy_values_rate_cache.hpp"
+#include "yy_values_series_cache.hpp"
+#include "yy_values_stats.hpp"
+
+namespace yafiyogi::yy_values {
+
+class Metric;
+
+// Per-call scratch state for Metric::Event. A Metric is immutable, so
+// threads can share one Metric as long as each uses its own context.
+// Create contexts with Metric::CreateContext().
+class MetricContext final
+{
+  public:
+    constexpr MetricContext() noexcept = default;
+    MetricContext(const MetricContext &) = default;
+    MetricContext(MetricContext &&) noexcept = default;
+
+    MetricContext & operator=(const MetricContext &) = default;
+    MetricContext & operator=(MetricContext &&) noexcept = default;
+
+  private:
+    friend class Metric;
+
+    MetricData m_metric_data{};
+    Labels m_metric_properties{};
+    ReplacePathCaches m_property_caches{};
+    ReplacePathCaches m_label_caches{};
+    SeriesCache m_series_cache{};
+    RateCache m_rate_cache{};
+    MetricStats m_stats{};
+};
+
+} // namespace yafiyogi::yy_values
@@ -52,6 +52,10 @@ MetricData & MetricData::operator=(MetricData && p_other) noexcept
     m_binary = std::move(p_other.m_binary);
     m_value_type = p_other.m_value_type;
     p_other.m_value_type = ValueType::Unknown;
+    m_value_status = p_other.m_value_status;
+    p_other.m_value_status = ValueStatus::Unparsed;
+    m_unchanged = p_other.m_unchanged;
+    p_other.m_unchanged = false;
   }
   return *this;
 }
@@ -66,6 +70,8 @@ void MetricData::swap(MetricData & p_other) noexcept
     std::swap(m_value, p_other.m_value);
     std::swap(m_binary, p_other.m_binary);
     std::swap(m_value_type, p_other.m_value_type);
+    std::swap(m_value_status, p_other.m_value_status);
+    std::swap(m_unchanged, p_other.m_unchanged);
   }
 }
 
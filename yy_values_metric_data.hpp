@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <variant>
 
 #include "yy_cpp/yy_types.hpp"
@@ -42,7 +43,7 @@ namespace yafiyogi::yy_values {
 class MetricData
 {
   public:
-    using binary_type = std::variant<double, int64_t, bool>;
+    using binary_type = std::variant<double, int64_t, bool, uint64_t>;
 
     MetricData(const MetricId & p_id) noexcept;
     MetricData(MetricId && p_id,
@@ -56,10 +57,14 @@ class MetricData
       m_timestamp(p_other.m_timestamp),
       m_value(std::move(p_other.m_value)),
       m_binary(std::move(p_other.m_binary)),
-      m_value_type(p_other.m_value_type)
+      m_value_type(p_other.m_value_type),
+      m_value_status(p_other.m_value_status),
+      m_unchanged(p_other.m_unchanged)
     {
       p_other.m_timestamp = timestamp_type{};
       p_other.m_value_type = ValueType::Unknown;
+      p_other.m_value_status = ValueStatus::Unparsed;
+      p_other.m_unchanged = false;
     }
 
     virtual ~MetricData() noexcept = default;
@@ -74,7 +79,7 @@ class MetricData
 
     constexpr bool operator==(const MetricData & p_other) const noexcept
     {
-      return compare(p_other) == 0;
+      return m_id == p_other.m_id;
     }
 
     constexpr int compare(const MetricData & p_other) const noexcept
@@ -92,7 +97,7 @@ class MetricData
       m_id = p_id;
     }
 
-    constexpr void Location(const std::string & p_location) noexcept
+    constexpr void Location(std::string_view p_location) noexcept
     {
       m_id.Location(p_location);
     }
@@ -122,9 +127,11 @@ class MetricData
       return m_value;
     }
 
+    // A new value invalidates any parsed Binary().
     constexpr void Value(std::string_view p_value) noexcept
     {
       m_value = p_value;
+      m_value_status = ValueStatus::Unparsed;
     }
 
     constexpr binary_type Binary() const noexcept
@@ -147,6 +154,28 @@ class MetricData
       m_value_type = p_value_type;
     }
 
+    constexpr ValueStatus Status() const noexcept
+    {
+      return m_value_status;
+    }
+
+    constexpr void Status(ValueStatus p_value_status) noexcept
+    {
+      m_value_status = p_value_status;
+    }
+
+    // Set by Metrics using DedupMode::Mark when the sample repeats
+    // the series' last emitted value.
+    constexpr bool Unchanged() const noexcept
+    {
+      return m_unchanged;
+    }
+
+    constexpr void Unchanged(bool p_unchanged) noexcept
+    {
+      m_unchanged = p_unchanged;
+    }
+
     void swap(MetricData & p_other) noexcept;
 
     friend void swap(MetricData & p_lhs, MetricData & p_rhs) noexcept
@@ -161,6 +190,8 @@ class MetricData
     std::string m_value{};
     binary_type m_binary{};
     ValueType m_value_type = ValueType::Unknown;
+    ValueStatus m_value_status = ValueStatus::Unparsed;
+    bool m_unchanged = false;
 };
 
 using MetricDataObsPtr = yy_data::observer_ptr<MetricData>;
@@ -0,0 +1,97 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "yy_cpp/yy_clear_action.h"
+
+#include "yy_values_metric_data_pool.hpp"
+
+namespace yafiyogi::yy_values {
+
+MetricDataPool::MetricDataPool(size_type p_capacity) noexcept:
+  m_capacity(p_capacity)
+{
+}
+
+MetricDataVector MetricDataPool::Acquire()
+{
+  MetricDataVector metric_data{};
+  size_type capacity = 0;
+
+  {
+    std::lock_guard lck{m_mutex};
+
+    if(0 != m_available)
+    {
+      --m_available;
+      std::swap(metric_data, m_vectors[m_available]);
+    }
+
+    capacity = m_capacity;
+  }
+
+  metric_data.reserve(capacity);
+
+  return metric_data;
+}
+
+void MetricDataPool::Recycle(MetricDataVector && p_metric_data)
+{
+  const size_type l_size = p_metric_data.size();
+
+  p_metric_data.clear(yy_data::ClearAction::Keep);
+
+  std::lock_guard lck{m_mutex};
+
+  m_capacity = std::max(m_capacity, l_size);
+
+  if(m_available == m_vectors.size())
+  {
+    m_vectors.emplace_back();
+  }
+
+  std::swap(m_vectors[m_available], p_metric_data);
+  ++m_available;
+}
+
+size_type MetricDataPool::Available() const noexcept
+{
+  std::lock_guard lck{m_mutex};
+
+  return m_available;
+}
+
+size_type MetricDataPool::Capacity() const noexcept
+{
+  std::lock_guard lck{m_mutex};
+
+  return m_capacity;
+}
+
+} // namespace yafiyogi::yy_values
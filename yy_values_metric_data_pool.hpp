@@ -0,0 +1,80 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <mutex>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_values_metric_data.hpp"
+
+namespace yafiyogi::yy_values {
+
+// Free list of MetricDataVectors for collection cycles. A consumed
+// vector is recycled with ClearAction::Keep, so its MetricData slots
+// (labels, value strings) keep their buffers. Metric::Event swaps
+// each warm slot into its context as it appends, and acquired vectors
+// are reserved to the largest cycle seen, so they never regrow.
+//
+// Acquire() and Recycle() may be called from different threads.
+class MetricDataPool final
+{
+  public:
+    explicit MetricDataPool(size_type p_capacity) noexcept;
+    MetricDataPool() noexcept = default;
+
+    MetricDataPool(const MetricDataPool &) = delete;
+    MetricDataPool(MetricDataPool &&) = delete;
+
+    MetricDataPool & operator=(const MetricDataPool &) = delete;
+    MetricDataPool & operator=(MetricDataPool &&) = delete;
+
+    // Returns an empty vector, warmed by earlier cycles if available.
+    [[nodiscard]]
+    MetricDataVector Acquire();
+
+    // Hands a consumed vector back to the pool.
+    void Recycle(MetricDataVector && p_metric_data);
+
+    [[nodiscard]]
+    size_type Available() const noexcept;
+
+    [[nodiscard]]
+    size_type Capacity() const noexcept;
+
+  private:
+    using Vectors = yy_quad::simple_vector<MetricDataVector>;
+
+    mutable std::mutex m_mutex{};
+    // Entries past m_available are empty spare slots.
+    Vectors m_vectors{};
+    size_type m_available = 0;
+    size_type m_capacity = 0;
+};
+
+} // namespace yafiyogi::yy_values
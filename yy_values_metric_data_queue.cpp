@@ -0,0 +1,146 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+#include "yy_values_metric_data_queue.hpp"
+
+namespace yafiyogi::yy_values {
+namespace {
+
+size_type queue_capacity(size_type p_capacity) noexcept
+{
+  return std::bit_ceil(std::max(p_capacity, size_type{2}));
+}
+
+} // anonymous namespace
+
+MetricDataSpscQueue::MetricDataSpscQueue(size_type p_capacity):
+  m_slots(std::make_unique<MetricData[]>(queue_capacity(p_capacity))),
+  m_mask(queue_capacity(p_capacity) - 1)
+{
+}
+
+bool MetricDataSpscQueue::Push(MetricData & p_metric_data) noexcept
+{
+  const size_type tail = m_tail.load(std::memory_order_relaxed);
+
+  if((tail - m_cached_head) > m_mask)
+  {
+    m_cached_head = m_head.load(std::memory_order_acquire);
+    if((tail - m_cached_head) > m_mask)
+    {
+      return false;
+    }
+  }
+
+  m_slots[tail & m_mask].swap(p_metric_data);
+  m_tail.store(tail + 1, std::memory_order_release);
+
+  return true;
+}
+
+bool MetricDataSpscQueue::Pop(MetricData & p_metric_data) noexcept
+{
+  const size_type head = m_head.load(std::memory_order_relaxed);
+
+  if(head == m_cached_tail)
+  {
+    m_cached_tail = m_tail.load(std::memory_order_acquire);
+    if(head == m_cached_tail)
+    {
+      return false;
+    }
+  }
+
+  m_slots[head & m_mask].swap(p_metric_data);
+  m_head.store(head + 1, std::memory_order_release);
+
+  return true;
+}
+
+MetricDataMpscQueue::MetricDataMpscQueue(size_type p_capacity):
+  m_slots(std::make_unique<Slot[]>(queue_capacity(p_capacity))),
+  m_mask(queue_capacity(p_capacity) - 1)
+{
+  for(size_type idx = 0; idx <= m_mask; ++idx)
+  {
+    m_slots[idx].sequence.store(idx, std::memory_order_relaxed);
+  }
+}
+
+bool MetricDataMpscQueue::Push(MetricData & p_metric_data) noexcept
+{
+  size_type tail = m_tail.load(std::memory_order_relaxed);
+
+  while(true)
+  {
+    auto & slot = m_slots[tail & m_mask];
+    const size_type sequence = slot.sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::ptrdiff_t>(sequence - tail);
+
+    if(0 == diff)
+    {
+      if(m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+      {
+        slot.metric_data.swap(p_metric_data);
+        slot.sequence.store(tail + 1, std::memory_order_release);
+
+        return true;
+      }
+    }
+    else if(diff < 0)
+    {
+      // Slot not yet consumed, queue is full.
+      return false;
+    }
+    else
+    {
+      tail = m_tail.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool MetricDataMpscQueue::Pop(MetricData & p_metric_data) noexcept
+{
+  auto & slot = m_slots[m_head & m_mask];
+  const size_type sequence = slot.sequence.load(std::memory_order_acquire);
+
+  if(sequence != (m_head + 1))
+  {
+    return false;
+  }
+
+  slot.metric_data.swap(p_metric_data);
+  slot.sequence.store(m_head + m_mask + 1, std::memory_order_release);
+  ++m_head;
+
+  return true;
+}
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,126 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "yy_cpp/yy_types.hpp"
+
+#include "yy_values_metric_data.hpp"
+
+namespace yafiyogi::yy_values {
+namespace metric_data_queue_detail {
+
+inline constexpr std::size_t cache_line_size = 64;
+
+} // namespace metric_data_queue_detail
+
+// Bounded lock-free hand-off of MetricData between threads. Capacity
+// is rounded up to a power of two and every slot is constructed up
+// front. Push() and Pop() swap the caller's MetricData with a slot,
+// so the caller gets back a warm object and no strings are copied or
+// reallocated across the hand-off.
+
+// One producer thread, one consumer thread.
+class MetricDataSpscQueue final
+{
+  public:
+    explicit MetricDataSpscQueue(size_type p_capacity);
+
+    MetricDataSpscQueue(const MetricDataSpscQueue &) = delete;
+    MetricDataSpscQueue(MetricDataSpscQueue &&) = delete;
+
+    MetricDataSpscQueue & operator=(const MetricDataSpscQueue &) = delete;
+    MetricDataSpscQueue & operator=(MetricDataSpscQueue &&) = delete;
+
+    // Returns false if the queue is full; p_metric_data is unchanged.
+    [[nodiscard]]
+    bool Push(MetricData & p_metric_data) noexcept;
+
+    // Returns false if the queue is empty; p_metric_data is unchanged.
+    [[nodiscard]]
+    bool Pop(MetricData & p_metric_data) noexcept;
+
+    [[nodiscard]]
+    constexpr size_type capacity() const noexcept
+    {
+      return m_mask + 1;
+    }
+
+  private:
+    std::unique_ptr<MetricData[]> m_slots;
+    size_type m_mask = 0;
+
+    alignas(metric_data_queue_detail::cache_line_size) std::atomic<size_type> m_head{0};
+    size_type m_cached_tail = 0;
+    alignas(metric_data_queue_detail::cache_line_size) std::atomic<size_type> m_tail{0};
+    size_type m_cached_head = 0;
+};
+
+// Any number of producer threads, one consumer thread. Each slot
+// carries a sequence number (Vyukov's bounded queue), so producers
+// only contend on claiming a position.
+class MetricDataMpscQueue final
+{
+  public:
+    explicit MetricDataMpscQueue(size_type p_capacity);
+
+    MetricDataMpscQueue(const MetricDataMpscQueue &) = delete;
+    MetricDataMpscQueue(MetricDataMpscQueue &&) = delete;
+
+    MetricDataMpscQueue & operator=(const MetricDataMpscQueue &) = delete;
+    MetricDataMpscQueue & operator=(MetricDataMpscQueue &&) = delete;
+
+    [[nodiscard]]
+    bool Push(MetricData & p_metric_data) noexcept;
+
+    [[nodiscard]]
+    bool Pop(MetricData & p_metric_data) noexcept;
+
+    [[nodiscard]]
+    constexpr size_type capacity() const noexcept
+    {
+      return m_mask + 1;
+    }
+
+  private:
+    struct Slot
+    {
+        std::atomic<size_type> sequence{0};
+        MetricData metric_data{};
+    };
+
+    std::unique_ptr<Slot[]> m_slots;
+    size_type m_mask = 0;
+
+    alignas(metric_data_queue_detail::cache_line_size) std::atomic<size_type> m_tail{0};
+    alignas(metric_data_queue_detail::cache_line_size) size_type m_head = 0;
+};
+
+} // namespace yafiyogi::yy_values
@@ -42,13 +42,14 @@ MetricId::MetricId(std::string_view p_metric_id) noexcept
 
   auto location{tokenizer.source()};
   m_location = std::string{location.begin(), location.end()};
-
+  m_hash = hash(m_name, m_location);
 }
 
 MetricId::MetricId(std::string_view p_name,
                    std::string_view p_location) noexcept:
   m_name(p_name),
-  m_location(p_location)
+  m_location(p_location),
+  m_hash(hash(m_name, m_location))
 {
 }
 
@@ -26,7 +26,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
+
+#include "yy_values_hash.hpp"
 
 namespace yafiyogi::yy_values {
 
@@ -51,7 +56,7 @@ class MetricId final
 
     constexpr bool operator==(const MetricId & p_other) const noexcept
     {
-      return compare(p_other) == 0;
+      return (m_hash == p_other.m_hash) && (compare(p_other) == 0);
     }
 
     constexpr int compare(const MetricId & p_other) const noexcept
@@ -75,19 +80,51 @@ class MetricId final
       return m_location;
     }
 
-    constexpr void Location(const std::string & p_location) noexcept
+    // Setting the current location again leaves the hash as it is.
+    constexpr void Location(std::string_view p_location) noexcept
     {
-      m_location = p_location;
+      if(p_location != m_location)
+      {
+        m_location = p_location;
+        m_hash = hash(m_name, m_location);
+      }
     }
 
     constexpr void Location(std::string && p_location) noexcept
     {
-      m_location = std::move(p_location);
+      if(p_location != m_location)
+      {
+        m_location = std::move(p_location);
+        m_hash = hash(m_name, m_location);
+      }
+    }
+
+    // Hash of name and location, kept up to date by every setter.
+    [[nodiscard]]
+    constexpr uint64_t Hash() const noexcept
+    {
+      return m_hash;
+    }
+
+    static constexpr uint64_t hash(std::string_view p_name,
+                                   std::string_view p_location) noexcept
+    {
+      return hash_combine(hash_string(p_name), hash_string(p_location));
     }
 
   private:
     std::string m_name{};
     std::string m_location{};
+    uint64_t m_hash = hash(std::string_view{}, std::string_view{});
 };
 
 } // namespace yafiyogi::yy_values
+
+template<>
+struct std::hash<yafiyogi::yy_values::MetricId>
+{
+    constexpr std::size_t operator()(const yafiyogi::yy_values::MetricId & p_id) const noexcept
+    {
+      return static_cast<std::size_t>(p_id.Hash());
+    }
+};
@@ -28,9 +28,14 @@
 
 #include <string_view>
 
+#include "yy_values_label_id.hpp"
+
 namespace yafiyogi::yy_values {
 
 inline constexpr std::string_view g_label_location{"location"};
 inline constexpr std::string_view g_label_topic{"topic"};
 
+inline constexpr LabelId g_label_location_id{label_id_detail::location_id};
+inline constexpr LabelId g_label_topic_id{label_id_detail::topic_id};
+
 } // namespace yafiyogi::yy_values
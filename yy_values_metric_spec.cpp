@@ -0,0 +1,500 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <tuple>
+
+#include "spdlog/spdlog.h"
+
+#include "yy_cpp/yy_flat_set.h"
+#include "yy_cpp/yy_utility.h"
+
+#include "yy_label_action_copy.hpp"
+#include "yy_label_action_drop.hpp"
+#include "yy_label_action_keep.hpp"
+#include "yy_label_action_replace_path.hpp"
+#include "yy_value_action_range.hpp"
+#include "yy_value_action_switch.hpp"
+#include "yy_value_action_transform.hpp"
+#include "yy_values_label_id.hpp"
+#include "yy_values_metric_labels.hpp"
+
+#include "yy_values_metric_spec.hpp"
+
+namespace yafiyogi::yy_values {
+
+using namespace std::string_view_literals;
+
+namespace {
+
+template<typename Container>
+bool equal_elements(const Container & p_lhs,
+                    const Container & p_rhs) noexcept
+{
+  return std::equal(p_lhs.begin(), p_lhs.end(),
+                    p_rhs.begin(), p_rhs.end());
+}
+
+using ClaimedMetrics = yy_data::flat_set<const Metric *>;
+
+// The fingerprint only narrows the search; a Metric is reused only if
+// it was built from an equal spec. Each previous Metric is claimed at
+// most once, so equal specs in one handler keep one Metric (and one
+// context) each.
+MetricPtr find_previous_metric(const MetricsMap * p_previous,
+                               const MetricSpec & p_spec,
+                               ClaimedMetrics & p_claimed)
+{
+  MetricPtr metric{};
+
+  if(nullptr != p_previous)
+  {
+    auto do_find = [&p_spec, &p_claimed, &metric](auto p_handler_metrics, auto) {
+      for(const auto & previous_metric : *p_handler_metrics)
+      {
+        if((p_spec.fingerprint == previous_metric->Fingerprint())
+           && (nullptr != previous_metric->Spec())
+           && (p_spec == *previous_metric->Spec()))
+        {
+          if(auto [ignore, claimed] = p_claimed.emplace(previous_metric.get());
+             claimed)
+          {
+            metric = previous_metric;
+            break;
+          }
+        }
+      }
+    };
+
+    std::ignore = p_previous->find_value(do_find, p_spec.handler_id);
+  }
+
+  return metric;
+}
+
+// LabelIds are numbered in intern order, which sets Labels order, so
+// intern every label name serially, in spec order, before building.
+// One batch publishes the label table once.
+void intern_spec_labels(const MetricSpecs & p_specs)
+{
+  yy_quad::simple_vector<std::string_view> labels{};
+
+  for(const auto & spec : p_specs)
+  {
+    for(const auto & action : spec.label_actions)
+    {
+      if(LabelOpCode::Copy == action.op)
+      {
+        labels.emplace_back(action.source);
+      }
+      labels.emplace_back(action.target);
+    }
+  }
+
+  intern_labels(std::span<const std::string_view>{labels.data(), labels.size()});
+}
+
+// Logged from the serial pass so output order does not depend on
+// which worker built the table.
+void log_switch_fallbacks(const ValueActions & p_value_actions,
+                          std::string_view p_value_id)
+{
+  for(const auto & action : p_value_actions)
+  {
+    if(SwitchValueAction::action_name == action->Name())
+    {
+      const auto & table = static_cast<const SwitchValueAction &>(*action).Table();
+
+      if(table.fell_back())
+      {
+        spdlog::warn(" switch table of [{}] entries for metric [{}] has no perfect hash, using binary search."sv,
+                     table.size(),
+                     p_value_id);
+      }
+    }
+  }
+}
+
+struct MetricParts
+{
+    LabelActions label_actions{};
+    ValueActions value_actions{};
+    LabelActions property_actions{};
+};
+
+using MetricPartsVector = yy_quad::simple_vector<MetricParts>;
+using MetricPtrs = yy_quad::simple_vector<MetricPtr>;
+
+MetricParts create_metric_parts(const MetricSpec & p_spec)
+{
+  return MetricParts{create_label_actions(p_spec.label_actions),
+                     create_value_actions(p_spec.value_actions),
+                     create_property_actions(p_spec.location)};
+}
+
+MetricPtr create_metric(const MetricSpec & p_spec,
+                        MetricParts && p_parts)
+{
+  return std::make_shared<Metric>(MetricId{p_spec.value_id, std::string{}},
+                                  std::string{p_spec.property},
+                                  std::move(p_parts.label_actions),
+                                  std::move(p_parts.value_actions),
+                                  std::move(p_parts.property_actions),
+                                  DedupConfig{p_spec.dedup},
+                                  RateConfig{p_spec.rate},
+                                  p_spec.cache_capacity,
+                                  std::make_shared<const MetricSpec>(p_spec));
+}
+
+// Builds the parts of every spec without a reused Metric. Workers
+// write only their own slot, so the result does not depend on
+// scheduling.
+MetricPartsVector build_metric_parts(const MetricSpecs & p_specs,
+                                     const MetricPtrs & p_reused,
+                                     size_type p_num_to_build,
+                                     size_type p_max_threads)
+{
+  const size_type num_specs = p_specs.size();
+  MetricPartsVector parts(num_specs);
+
+  if(0 == p_max_threads)
+  {
+    p_max_threads = std::max(size_type{1}, static_cast<size_type>(std::thread::hardware_concurrency()));
+  }
+
+  const size_type num_threads = std::min(p_max_threads,
+                                         p_num_to_build / metric_spec_detail::min_specs_per_thread);
+
+  metric_spec_detail::parallel_build(num_specs, num_threads, [&](size_type p_idx) {
+    if(!p_reused[p_idx])
+    {
+      parts[p_idx] = create_metric_parts(p_specs[p_idx]);
+    }
+  });
+
+  return parts;
+}
+
+} // anonymous namespace
+
+namespace metric_spec_detail {
+
+void parallel_build(size_type p_num_items,
+                    size_type p_num_threads,
+                    const std::function<void(size_type)> & p_build)
+{
+  std::atomic<size_type> next{0};
+  std::exception_ptr error{};
+  std::mutex error_mtx{};
+
+  auto do_build = [&]() {
+    for(size_type idx = next.fetch_add(1, std::memory_order_relaxed);
+        idx < p_num_items;
+        idx = next.fetch_add(1, std::memory_order_relaxed))
+    {
+      try
+      {
+        p_build(idx);
+      }
+      catch(...)
+      {
+        std::unique_lock lck{error_mtx};
+        if(!error)
+        {
+          error = std::current_exception();
+        }
+      }
+    }
+  };
+
+  {
+    yy_quad::simple_vector<std::jthread> workers{};
+    if(p_num_threads > 1)
+    {
+      workers.reserve(p_num_threads - 1);
+      for(size_type thread_idx = 1; thread_idx < p_num_threads; ++thread_idx)
+      {
+        workers.emplace_back(do_build);
+      }
+    }
+
+    do_build();
+  } // Workers join here.
+
+  if(error)
+  {
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace metric_spec_detail
+
+bool operator==(const ReplacePathSpec & p_lhs, const ReplacePathSpec & p_rhs) noexcept
+{
+  return (p_lhs.pattern == p_rhs.pattern)
+    && equal_elements(p_lhs.format, p_rhs.format);
+}
+
+bool operator==(const LabelActionSpec & p_lhs, const LabelActionSpec & p_rhs) noexcept
+{
+  return (p_lhs.op == p_rhs.op)
+    && (p_lhs.source == p_rhs.source)
+    && (p_lhs.target == p_rhs.target)
+    && equal_elements(p_lhs.replace, p_rhs.replace);
+}
+
+bool operator==(const ValueActionSpec & p_lhs, const ValueActionSpec & p_rhs) noexcept
+{
+  return (p_lhs.op == p_rhs.op)
+    && (p_lhs.default_value == p_rhs.default_value)
+    && equal_elements(p_lhs.mappings, p_rhs.mappings)
+    && equal_elements(p_lhs.ranges, p_rhs.ranges)
+    && equal_elements(p_lhs.steps, p_rhs.steps);
+}
+
+bool operator==(const MetricSpec & p_lhs, const MetricSpec & p_rhs) noexcept
+{
+  return (p_lhs.fingerprint == p_rhs.fingerprint)
+    && (p_lhs.handler_id == p_rhs.handler_id)
+    && (p_lhs.value_id == p_rhs.value_id)
+    && (p_lhs.property == p_rhs.property)
+    && equal_elements(p_lhs.location, p_rhs.location)
+    && equal_elements(p_lhs.label_actions, p_rhs.label_actions)
+    && equal_elements(p_lhs.value_actions, p_rhs.value_actions)
+    && (p_lhs.dedup == p_rhs.dedup)
+    && (p_lhs.rate == p_rhs.rate)
+    && (p_lhs.cache_capacity == p_rhs.cache_capacity);
+}
+
+ReplacementTopics create_replacement_topics(const ReplacePathSpecs & p_specs)
+{
+  ReplacementTopicsConfig topics_config{};
+
+  for(const auto & spec : p_specs)
+  {
+    std::ignore = topics_config.add(spec.pattern,
+                                    ReplaceFormat{spec.format});
+  }
+
+  return topics_config.create_automaton();
+}
+
+LabelActions create_label_actions(const LabelActionSpecs & p_specs)
+{
+  LabelActions label_actions{};
+  label_actions.reserve(p_specs.size());
+
+  for(const auto & spec : p_specs)
+  {
+    LabelActionPtr action;
+
+    switch(spec.op)
+    {
+      case LabelOpCode::Copy:
+        action = yy_util::static_unique_cast<LabelAction>(std::make_unique<CopyLabelAction>(intern_label(spec.source),
+                                                                                            intern_label(spec.target)));
+        break;
+
+      case LabelOpCode::Drop:
+        action = yy_util::static_unique_cast<LabelAction>(std::make_unique<DropLabelAction>(intern_label(spec.target)));
+        break;
+
+      case LabelOpCode::Keep:
+        action = yy_util::static_unique_cast<LabelAction>(std::make_unique<KeepLabelAction>(intern_label(spec.target)));
+        break;
+
+      case LabelOpCode::ReplacePath:
+        action = yy_util::static_unique_cast<LabelAction>(std::make_unique<ReplacePathLabelAction>(intern_label(spec.target),
+                                                                                                   create_replacement_topics(spec.replace)));
+        break;
+    }
+
+    if(action)
+    {
+      label_actions.emplace_back(std::move(action));
+    }
+  }
+
+  return label_actions;
+}
+
+ValueActions create_value_actions(const ValueActionSpecs & p_specs)
+{
+  ValueActions value_actions{};
+  value_actions.reserve(p_specs.size());
+
+  for(size_type idx = 0; idx < p_specs.size(); ++idx)
+  {
+    const auto & spec = p_specs[idx];
+    ValueActionPtr action;
+
+    switch(spec.op)
+    {
+      case ValueOpCode::Switch:
+      {
+        SwitchValueAction::Switch switch_values;
+        switch_values.reserve(spec.mappings.size());
+
+        for(const auto & [input, output] : spec.mappings)
+        {
+          switch_values.emplace(std::string{input},
+                                std::string{output});
+        }
+
+        action = yy_util::static_unique_cast<ValueAction>(std::make_unique<SwitchValueAction>(std::string{spec.default_value},
+                                                                                              std::move(switch_values)));
+      }
+      break;
+
+      case ValueOpCode::Range:
+        action = yy_util::static_unique_cast<ValueAction>(std::make_unique<RangeValueAction>(std::string{spec.default_value},
+                                                                                             RangeValueAction::Ranges{spec.ranges}));
+        break;
+
+      case ValueOpCode::Transform:
+      {
+        // Consecutive transforms fuse into one action, up to and
+        // including the first with a default. Run separately, later
+        // steps would transform that default, so they start a new
+        // action which parses it.
+        TransformSteps steps{spec.steps};
+        while(p_specs[idx].default_value.empty()
+              && ((idx + 1) < p_specs.size())
+              && (ValueOpCode::Transform == p_specs[idx + 1].op))
+        {
+          ++idx;
+          for(const auto & step : p_specs[idx].steps)
+          {
+            steps.emplace_back(step);
+          }
+        }
+
+        action = yy_util::static_unique_cast<ValueAction>(std::make_unique<TransformValueAction>(std::string{p_specs[idx].default_value},
+                                                                                                 std::move(steps)));
+      }
+      break;
+    }
+
+    if(action)
+    {
+      value_actions.emplace_back(std::move(action));
+    }
+  }
+
+  return value_actions;
+}
+
+LabelActions create_property_actions(const ReplacePathSpecs & p_location)
+{
+  LabelActions property_actions{};
+
+  if(!p_location.empty())
+  {
+    property_actions.emplace_back(yy_util::static_unique_cast<LabelAction>(std::make_unique<ReplacePathLabelAction>(g_label_location_id,
+                                                                                                                    create_replacement_topics(p_location))));
+  }
+
+  return property_actions;
+}
+
+MetricPtr create_metric(const MetricSpec & p_spec)
+{
+  return create_metric(p_spec, create_metric_parts(p_spec));
+}
+
+MetricsMap create_metrics(const MetricSpecs & p_specs,
+                          const MetricsMap * p_previous,
+                          size_type p_max_threads)
+{
+  const size_type num_specs = p_specs.size();
+  MetricPtrs metrics_built(num_specs);
+  size_type num_reused = 0;
+  ClaimedMetrics claimed{};
+
+  for(size_type idx = 0; idx < num_specs; ++idx)
+  {
+    const auto & spec = p_specs[idx];
+    if(metrics_built[idx] = find_previous_metric(p_previous, spec, claimed);
+       metrics_built[idx])
+    {
+      ++num_reused;
+    }
+  }
+
+  intern_spec_labels(p_specs);
+
+  // Actions are built in parallel; the Metrics themselves are created
+  // below, in order.
+  auto parts{build_metric_parts(p_specs, metrics_built, num_specs - num_reused, p_max_threads)};
+
+  MetricsMap metrics{};
+
+  for(size_type idx = 0; idx < num_specs; ++idx)
+  {
+    const auto & spec = p_specs[idx];
+    auto & metric = metrics_built[idx];
+
+    if(metric)
+    {
+      spdlog::info(" reuse unchanged metric [{}] for handler [{}]."sv,
+                   metric->Id().Name(),
+                   spec.handler_id);
+    }
+    else
+    {
+      log_switch_fallbacks(parts[idx].value_actions, spec.value_id);
+      metric = create_metric(spec, std::move(parts[idx]));
+
+      spdlog::info(" add metric [{}] to handler [{}] property [{}]."sv,
+                   metric->Id().Name(),
+                   spec.handler_id,
+                   metric->Property());
+    }
+
+    auto [metrics_pos, ignore_found] = metrics.emplace(std::string{spec.handler_id},
+                                                       Metrics{});
+
+    auto [ignore_key, handler_metrics] = metrics[metrics_pos];
+
+    handler_metrics.emplace_back(std::move(metric));
+  }
+
+  if(nullptr != p_previous)
+  {
+    spdlog::info(" Reused [{}] of [{}] metrics."sv, num_reused, num_specs);
+  }
+
+  return metrics;
+}
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,135 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_label_action_program.hpp"
+#include "yy_replacement_format.hpp"
+#include "yy_replacement_topics.hpp"
+#include "yy_value_action_range.hpp"
+#include "yy_value_action_transform.hpp"
+#include "yy_values_metric.hpp"
+#include "yy_values_series_cache.hpp"
+
+namespace yafiyogi::yy_values {
+namespace metric_spec_detail {
+
+// Fewer specs than this per thread are not worth a thread.
+inline constexpr size_type min_specs_per_thread = 16;
+
+// Calls p_build once for each index below p_num_items, on up to
+// p_num_threads threads including the caller's. Threads claim indices
+// in order. The first exception thrown is rethrown once every thread
+// has finished; the other indices are still built.
+void parallel_build(size_type p_num_items,
+                    size_type p_num_threads,
+                    const std::function<void(size_type)> & p_build);
+
+} // namespace metric_spec_detail
+
+// Parsed, but not yet built, configuration. configure_values() reads
+// YAML into specs and builds Metrics from them; specs can also be
+// saved and loaded as a binary snapshot (see yy_values_snapshot.hpp).
+// Label names are kept as strings and interned when built.
+
+struct ReplacePathSpec
+{
+    std::string pattern{};
+    ReplaceFormat format{};
+};
+
+using ReplacePathSpecs = yy_quad::simple_vector<ReplacePathSpec>;
+
+struct LabelActionSpec
+{
+    LabelOpCode op = LabelOpCode::Keep;
+    std::string source{};
+    std::string target{};
+    ReplacePathSpecs replace{};
+};
+
+using LabelActionSpecs = yy_quad::simple_vector<LabelActionSpec>;
+
+enum class ValueOpCode:uint8_t {Switch, Range, Transform};
+
+struct ValueActionSpec
+{
+    using Mapping = std::pair<std::string, std::string>;
+    using Mappings = yy_quad::simple_vector<Mapping>;
+
+    ValueOpCode op = ValueOpCode::Switch;
+    std::string default_value{};
+    Mappings mappings{}; // Switch
+    RangeValueAction::Ranges ranges{}; // Range
+    TransformSteps steps{}; // Transform
+};
+
+using ValueActionSpecs = yy_quad::simple_vector<ValueActionSpec>;
+
+struct MetricSpec
+{
+    std::string handler_id{};
+    std::string value_id{};
+    std::string property{};
+    ReplacePathSpecs location{};
+    LabelActionSpecs label_actions{};
+    ValueActionSpecs value_actions{};
+    DedupConfig dedup{};
+    RateConfig rate{};
+    size_type cache_capacity = replace_path_cache_detail::default_capacity;
+    uint64_t fingerprint = 0;
+};
+
+using MetricSpecs = yy_quad::simple_vector<MetricSpec>;
+
+bool operator==(const ReplacePathSpec & p_lhs, const ReplacePathSpec & p_rhs) noexcept;
+bool operator==(const LabelActionSpec & p_lhs, const LabelActionSpec & p_rhs) noexcept;
+bool operator==(const ValueActionSpec & p_lhs, const ValueActionSpec & p_rhs) noexcept;
+bool operator==(const MetricSpec & p_lhs, const MetricSpec & p_rhs) noexcept;
+
+ReplacementTopics create_replacement_topics(const ReplacePathSpecs & p_specs);
+LabelActions create_label_actions(const LabelActionSpecs & p_specs);
+ValueActions create_value_actions(const ValueActionSpecs & p_specs);
+LabelActions create_property_actions(const ReplacePathSpecs & p_location);
+MetricPtr create_metric(const MetricSpec & p_spec);
+
+// See configure_values() for p_previous. Actions are built on up to
+// p_max_threads threads (0 for one per core); Metrics are then created
+// and logged in spec order, so the result and log output do not depend
+// on the thread count.
+MetricsMap create_metrics(const MetricSpecs & p_specs,
+                          const MetricsMap * p_previous = nullptr,
+                          size_type p_max_threads = 0);
+
+} // namespace yafiyogi::yy_values
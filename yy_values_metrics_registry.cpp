@@ -0,0 +1,172 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+
+#include "yy_values_metrics_registry.hpp"
+
+namespace yafiyogi::yy_values {
+namespace {
+
+// Moves the contexts of Metrics shared by both configurations, so
+// their warmed buffers and caches carry over.
+void keep_contexts(const MetricsMap & p_old_metrics,
+                   MetricsContextMap & p_old_contexts,
+                   const MetricsMap & p_metrics,
+                   MetricsContextMap & p_contexts)
+{
+  // Contexts are built from p_metrics, so both maps share positions.
+  size_type pos = 0;
+
+  p_metrics.visit([&pos, &p_contexts, &p_old_metrics, &p_old_contexts](const auto & p_handler_id,
+                                                                       const auto & p_handler_metrics) {
+    auto [ignore_key, handler_contexts] = p_contexts[pos];
+    ++pos;
+
+    auto do_keep = [&p_handler_metrics, &handler_contexts, &p_old_contexts](auto p_old_handler_metrics, auto p_old_pos) {
+      auto [ignore_old_key, old_contexts] = p_old_contexts[p_old_pos];
+      const auto & old_metrics = *p_old_handler_metrics;
+
+      for(size_type idx = 0; idx < p_handler_metrics.size(); ++idx)
+      {
+        for(size_type old_idx = 0; old_idx < old_metrics.size(); ++old_idx)
+        {
+          if(p_handler_metrics[idx] == old_metrics[old_idx])
+          {
+            handler_contexts[idx] = std::move(old_contexts[old_idx]);
+            break;
+          }
+        }
+      }
+    };
+
+    std::ignore = p_old_metrics.find_value(do_keep, p_handler_id);
+  });
+}
+
+} // anonymous namespace
+
+MetricsRegistry::MetricsRegistry():
+  m_config(std::make_shared<const MetricsConfig>())
+{
+}
+
+MetricsConfigPtr MetricsRegistry::Acquire() const noexcept
+{
+  return m_config.load(std::memory_order_acquire);
+}
+
+uint64_t MetricsRegistry::Version() const noexcept
+{
+  return Acquire()->version;
+}
+
+uint64_t MetricsRegistry::Publish(MetricsMap && p_metrics)
+{
+  auto config{std::make_shared<MetricsConfig>()};
+  config->metrics = std::move(p_metrics);
+
+  std::lock_guard lck{m_publish_mtx};
+
+  config->version = ++m_version;
+  m_config.store(std::move(config), std::memory_order_release);
+
+  return m_version;
+}
+
+uint64_t MetricsRegistry::Reload(const YAML::Node & p_yaml_values)
+{
+  // One reload at a time, so each diffs against the latest config.
+  std::lock_guard lck{m_reload_mtx};
+
+  auto previous{Acquire()};
+
+  return Publish(configure_values(p_yaml_values, &previous->metrics));
+}
+
+std::future<uint64_t> MetricsRegistry::ReloadAsync(YAML::Node p_yaml_values)
+{
+  return std::async(std::launch::async,
+                    [this, yaml_values = std::move(p_yaml_values)]() {
+                      return Reload(yaml_values);
+                    });
+}
+
+MetricsReader::MetricsReader(const MetricsRegistry & p_registry):
+  m_registry(&p_registry),
+  m_config(p_registry.Acquire()),
+  m_contexts(create_contexts(m_config->metrics))
+{
+}
+
+bool MetricsReader::Refresh()
+{
+  auto config{m_registry->Acquire()};
+
+  if(config == m_config)
+  {
+    return false;
+  }
+
+  // Contexts must be rebuilt before the old config is released.
+  MetricsContextMap contexts{create_contexts(config->metrics)};
+
+  keep_contexts(m_config->metrics, m_contexts, config->metrics, contexts);
+
+  m_contexts = std::move(contexts);
+  m_config = std::move(config);
+
+  return true;
+}
+
+bool MetricsReader::Event(std::string_view p_handler_id,
+                          const MetricEvent & p_event,
+                          MetricDataVectorPtr p_metric_data)
+{
+  auto do_event = [this, &p_event, p_metric_data](auto p_handler_metrics, auto p_pos) {
+    auto [ignore_key, handler_contexts] = m_contexts[p_pos];
+    const auto & handler_metrics = *p_handler_metrics;
+
+    for(size_type idx = 0; idx < handler_metrics.size(); ++idx)
+    {
+      const Metric & metric = *handler_metrics[idx];
+
+      metric.Event(handler_contexts[idx], p_event, p_metric_data);
+    }
+  };
+
+  return m_config->metrics.find_value(do_event, p_handler_id).found;
+}
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,133 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+#include "yy_tp_util/yaml_fwd.h"
+
+#include "yy_values_metric.hpp"
+#include "yy_values_metric_data.hpp"
+
+namespace yafiyogi::yy_values {
+
+// One published configuration.
+struct MetricsConfig
+{
+    uint64_t version = 0;
+    MetricsMap metrics{};
+};
+
+using MetricsConfigPtr = std::shared_ptr<const MetricsConfig>;
+
+// Publishes MetricsMaps to running readers, RCU style. Readers take a
+// reference with Acquire() and keep using that configuration until
+// they release it; the old configuration is reclaimed when its last
+// reader lets go. Building a new configuration does not block readers.
+class MetricsRegistry final
+{
+  public:
+    MetricsRegistry();
+
+    MetricsRegistry(const MetricsRegistry &) = delete;
+    MetricsRegistry(MetricsRegistry &&) = delete;
+
+    MetricsRegistry & operator=(const MetricsRegistry &) = delete;
+    MetricsRegistry & operator=(MetricsRegistry &&) = delete;
+
+    [[nodiscard]]
+    MetricsConfigPtr Acquire() const noexcept;
+
+    [[nodiscard]]
+    uint64_t Version() const noexcept;
+
+    // Returns the version of the published configuration.
+    uint64_t Publish(MetricsMap && p_metrics);
+
+    // Builds a configuration on the calling thread and publishes it.
+    // Handlers whose YAML is unchanged keep their current Metric; the
+    // rest are built anew.
+    uint64_t Reload(const YAML::Node & p_yaml_values);
+
+    // As Reload(), on a separate thread. The registry must outlive the
+    // returned future, and p_yaml_values must not be used elsewhere
+    // until it completes.
+    [[nodiscard]]
+    std::future<uint64_t> ReloadAsync(YAML::Node p_yaml_values);
+
+  private:
+    std::atomic<MetricsConfigPtr> m_config;
+    std::mutex m_reload_mtx{};
+    std::mutex m_publish_mtx{};
+    uint64_t m_version = 0;
+};
+
+// Per-thread view of a MetricsRegistry. Holds the configuration and
+// the MetricContexts for it, so shared Metrics are only called through
+// this thread's contexts. Call Refresh() at a convenient point (e.g.
+// between batches) to move to the latest configuration.
+class MetricsReader final
+{
+  public:
+    explicit MetricsReader(const MetricsRegistry & p_registry);
+
+    MetricsReader(const MetricsReader &) = delete;
+    MetricsReader(MetricsReader &&) noexcept = default;
+
+    MetricsReader & operator=(const MetricsReader &) = delete;
+    MetricsReader & operator=(MetricsReader &&) noexcept = default;
+
+    // Returns true if a newer configuration was picked up. Contexts of
+    // Metrics reused by the new configuration are kept.
+    bool Refresh();
+
+    // Returns false if p_handler_id has no metrics. Each Metric takes
+    // the value of p_event for its own Property().
+    bool Event(std::string_view p_handler_id,
+               const MetricEvent & p_event,
+               MetricDataVectorPtr p_metric_data);
+
+    [[nodiscard]]
+    const MetricsConfig & Config() const noexcept
+    {
+      return *m_config;
+    }
+
+  private:
+    yy_data::observer_ptr<const MetricsRegistry> m_registry{};
+    MetricsConfigPtr m_config{};
+    MetricsContextMap m_contexts{};
+};
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,188 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <variant>
+
+#include "yy_values_rate_cache.hpp"
+
+namespace yafiyogi::yy_values {
+namespace {
+
+// Enough for the shortest round trip form of any double or integer.
+constexpr std::size_t max_format_size = 32;
+
+template<typename T>
+T counter_delta(T p_value,
+                T p_previous,
+                RateResult & p_result) noexcept
+{
+  if(p_value < p_previous)
+  {
+    p_result = RateResult::Reset;
+    return p_value;
+  }
+
+  return p_value - p_previous;
+}
+
+double as_double(MetricData::binary_type p_binary) noexcept
+{
+  return std::visit([](auto p_value) {
+    return static_cast<double>(p_value);
+  }, p_binary);
+}
+
+template<typename T>
+void set_value(MetricData & p_metric_data,
+               ValueType p_value_type,
+               T p_value) noexcept
+{
+  std::array<char, max_format_size> buffer{};
+  auto [ptr, ignore_ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), p_value);
+
+  p_metric_data.Value(std::string_view{buffer.data(), static_cast<std::size_t>(ptr - buffer.data())});
+  p_metric_data.Type(p_value_type);
+  p_metric_data.Binary(p_value);
+  p_metric_data.Status(ValueStatus::Ok);
+}
+
+// An Int counter can step from below zero to near INT64_MAX, so the
+// difference is taken in uint64_t, where it is exact. A delta too big
+// for an Int is emitted as a UInt.
+void set_int_delta(MetricData & p_metric_data,
+                   int64_t p_value,
+                   int64_t p_previous,
+                   RateResult & p_result) noexcept
+{
+  if(p_value < p_previous)
+  {
+    p_result = RateResult::Reset;
+    set_value(p_metric_data, ValueType::Int, p_value);
+    return;
+  }
+
+  const uint64_t delta = static_cast<uint64_t>(p_value) - static_cast<uint64_t>(p_previous);
+
+  if(delta > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+  {
+    set_value(p_metric_data, ValueType::UInt, delta);
+    return;
+  }
+
+  set_value(p_metric_data, ValueType::Int, static_cast<int64_t>(delta));
+}
+
+} // anonymous namespace
+
+RateCache::RateCache(size_type p_series,
+                     std::chrono::nanoseconds p_expiry):
+  m_series(p_series),
+  m_expiry_ns(p_expiry.count())
+{
+}
+
+RateResult RateCache::Apply(MetricData & p_metric_data,
+                            RateMode p_mode)
+{
+  if(RateMode::Off == p_mode)
+  {
+    return RateResult::Ok;
+  }
+
+  // A String, such as a range's output, has no rate.
+  if((ValueStatus::Ok != p_metric_data.Status())
+     || (ValueType::String == p_metric_data.Type()))
+  {
+    return RateResult::Unparsed;
+  }
+
+  const auto value = p_metric_data.Binary();
+  const int64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(p_metric_data.Timestamp().time_since_epoch()).count();
+
+  auto expired = [this, timestamp](const Sample & p_sample) {
+    return (0 != m_expiry_ns) && ((timestamp - p_sample.timestamp) > m_expiry_ns);
+  };
+
+  auto [entry, first] = m_series.find_or_add(p_metric_data, expired);
+  const auto previous = entry.value;
+  const int64_t elapsed = first ? 0 : (timestamp - entry.timestamp);
+
+  if(!first
+     && (RateMode::Rate == p_mode)
+     && (elapsed <= 0))
+  {
+    // Out of order or duplicate timestamp, keep the later sample.
+    return RateResult::Stale;
+  }
+
+  entry.timestamp = timestamp;
+  entry.value = value;
+
+  if(first)
+  {
+    return RateResult::First;
+  }
+
+  RateResult result = RateResult::Ok;
+
+  if(RateMode::Delta == p_mode)
+  {
+    if(const auto * int_value = std::get_if<int64_t>(&value);
+       (nullptr != int_value) && std::holds_alternative<int64_t>(previous))
+    {
+      set_int_delta(p_metric_data, *int_value, std::get<int64_t>(previous), result);
+      return result;
+    }
+
+    if(const auto * uint_value = std::get_if<uint64_t>(&value);
+       (nullptr != uint_value) && std::holds_alternative<uint64_t>(previous))
+    {
+      set_value(p_metric_data, ValueType::UInt, counter_delta(*uint_value, std::get<uint64_t>(previous), result));
+      return result;
+    }
+
+    set_value(p_metric_data, ValueType::Float, counter_delta(as_double(value), as_double(previous), result));
+    return result;
+  }
+
+  const double delta = counter_delta(as_double(value), as_double(previous), result);
+  const double seconds = static_cast<double>(elapsed) / 1e9;
+
+  set_value(p_metric_data, ValueType::Float, delta / seconds);
+  return result;
+}
+
+void RateCache::clear() noexcept
+{
+  m_series.clear();
+}
+
+} // namespace yafiyogi::yy_values
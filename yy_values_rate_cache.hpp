@@ -0,0 +1,107 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "yy_cpp/yy_types.hpp"
+
+#include "yy_values_metric_data.hpp"
+#include "yy_values_series_table.hpp"
+
+namespace yafiyogi::yy_values {
+
+enum class RateMode:uint8_t {Off, Delta, Rate};
+
+// Outcome of RateCache::Apply(). Only Ok and Reset produce a value.
+enum class RateResult:uint8_t {Ok, Reset, First, Unparsed, Stale};
+
+struct RateConfig
+{
+    RateMode mode = RateMode::Off;
+    // Series to preallocate room for; the store grows past it.
+    size_type series = 64;
+    // Series without a sample for this long are forgotten when the
+    // store is full, so their next sample counts as a first one. Zero
+    // keeps every series.
+    std::chrono::nanoseconds expiry{std::chrono::hours{1}};
+
+    bool operator==(const RateConfig &) const noexcept = default;
+};
+
+// Previous sample of each series (MetricId + Labels) seen by one
+// MetricContext, for turning counters into deltas or per-second rates.
+// Samples live in a preallocated SeriesTable, so steady state events
+// do not allocate.
+class RateCache final
+{
+  public:
+    explicit RateCache(size_type p_series,
+                       std::chrono::nanoseconds p_expiry = std::chrono::nanoseconds{0});
+
+    RateCache() noexcept = default;
+    RateCache(const RateCache &) = default;
+    RateCache(RateCache &&) noexcept = default;
+
+    RateCache & operator=(const RateCache &) = default;
+    RateCache & operator=(RateCache &&) noexcept = default;
+
+    // Replaces p_metric_data's parsed value with its change since the
+    // series' previous sample. A counter that goes backwards is taken
+    // to have reset to zero, so the delta is the new value (Reset).
+    // Delta keeps Int and UInt values integral (an Int delta above
+    // INT64_MAX becomes a UInt); Rate is always Float.
+    //
+    // Leaves p_metric_data unchanged for a series' first sample
+    // (First), an unparsed value (Unparsed), or in Rate mode a
+    // timestamp that has not advanced (Stale). Delta ignores
+    // timestamps and Off passes every value through.
+    [[nodiscard]]
+    RateResult Apply(MetricData & p_metric_data,
+                     RateMode p_mode);
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+      return m_series.size();
+    }
+
+    void clear() noexcept;
+
+  private:
+    struct Sample
+    {
+        int64_t timestamp = 0;
+        MetricData::binary_type value{};
+    };
+
+    SeriesTable<Sample> m_series{};
+    int64_t m_expiry_ns = 0;
+};
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,66 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "yy_values_metric_data.hpp"
+
+#include "yy_values_series_cache.hpp"
+
+namespace yafiyogi::yy_values {
+
+bool SeriesCache::Unchanged(const MetricData & p_metric_data,
+                            const DedupConfig & p_config)
+{
+  const auto l_value = p_metric_data.Value();
+  const auto l_timestamp = p_metric_data.Timestamp();
+
+  auto expired = [l_timestamp, &p_config](const Entry & p_entry) {
+    return (std::chrono::nanoseconds{0} != p_config.expiry)
+      && ((l_timestamp - p_entry.seen) > p_config.expiry);
+  };
+
+  auto [l_entry, added] = m_series.find_or_add(p_metric_data, expired);
+  l_entry.seen = l_timestamp;
+
+  if(!added
+     && (l_entry.value == l_value)
+     && ((std::chrono::nanoseconds{0} == p_config.heartbeat)
+         || ((l_timestamp - l_entry.emitted) < p_config.heartbeat)))
+  {
+    return true;
+  }
+
+  l_entry.value.assign(l_value);
+  l_entry.emitted = l_timestamp;
+
+  return false;
+}
+
+void SeriesCache::clear() noexcept
+{
+  m_series.clear();
+}
+
+} // namespace yafiyogi::yy_values
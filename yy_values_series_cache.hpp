@@ -0,0 +1,92 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "yy_cpp/yy_types.hpp"
+
+#include "yy_values_series_table.hpp"
+
+namespace yafiyogi::yy_values {
+
+enum class DedupMode:uint8_t {Off, Suppress, Mark};
+
+struct DedupConfig
+{
+    DedupMode mode = DedupMode::Off;
+    // A repeated sample is emitted anyway once this much time has
+    // passed since the series was last emitted. Zero never refreshes.
+    std::chrono::nanoseconds heartbeat{0};
+    // Series without a sample for this long are forgotten when the
+    // cache is full, so their next sample is emitted. Zero keeps every
+    // series.
+    std::chrono::nanoseconds expiry{std::chrono::hours{1}};
+
+    bool operator==(const DedupConfig &) const noexcept = default;
+};
+
+// Last emitted value of each series (MetricId + Labels) seen by one
+// MetricContext, held in a SeriesTable.
+class SeriesCache final
+{
+  public:
+    SeriesCache() noexcept = default;
+    SeriesCache(const SeriesCache &) = default;
+    SeriesCache(SeriesCache &&) noexcept = default;
+
+    SeriesCache & operator=(const SeriesCache &) = default;
+    SeriesCache & operator=(SeriesCache &&) noexcept = default;
+
+    // Returns true if p_metric_data repeats the series' last emitted
+    // value within the heartbeat. Otherwise records it as emitted.
+    [[nodiscard]]
+    bool Unchanged(const MetricData & p_metric_data,
+                   const DedupConfig & p_config);
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+      return m_series.size();
+    }
+
+    void clear() noexcept;
+
+  private:
+    struct Entry
+    {
+        std::string value{};
+        timestamp_type emitted{};
+        timestamp_type seen{};
+    };
+
+    SeriesTable<Entry> m_series{};
+};
+
+} // namespace yafiyogi::yy_values
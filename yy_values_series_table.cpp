@@ -0,0 +1,147 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "yy_values_hash.hpp"
+#include "yy_values_label_id.hpp"
+#include "yy_values_metric_id.hpp"
+
+#include "yy_values_series_table.hpp"
+
+namespace yafiyogi::yy_values {
+namespace series_table_detail {
+namespace {
+
+void append_u32(std::string & p_pool,
+                uint32_t p_value)
+{
+  p_pool.append(reinterpret_cast<const char *>(&p_value), sizeof(p_value));
+}
+
+void append_string(std::string & p_pool,
+                   std::string_view p_str)
+{
+  append_u32(p_pool, static_cast<uint32_t>(p_str.size()));
+  p_pool.append(p_str);
+}
+
+uint32_t read_u32(std::string_view & p_data) noexcept
+{
+  uint32_t value = 0;
+  std::memcpy(&value, p_data.data(), sizeof(value));
+  p_data.remove_prefix(sizeof(value));
+
+  return value;
+}
+
+std::string_view read_string(std::string_view & p_data) noexcept
+{
+  const auto size = read_u32(p_data);
+  auto str = p_data.substr(0, size);
+  p_data.remove_prefix(size);
+
+  return str;
+}
+
+} // anonymous namespace
+
+size_type entry_capacity(size_type p_series) noexcept
+{
+  return std::bit_ceil(std::max(min_entries, p_series + (p_series / 3) + 1));
+}
+
+uint64_t series_key(const MetricData & p_metric_data) noexcept
+{
+  return hash_combine(p_metric_data.Id().Hash(),
+                      p_metric_data.Labels().Hash());
+}
+
+void encode_identity(const MetricData & p_metric_data,
+                     std::string & p_pool)
+{
+  const auto & id = p_metric_data.Id();
+  append_string(p_pool, id.Name());
+  append_string(p_pool, id.Location());
+
+  const auto & labels = p_metric_data.Labels();
+  append_u32(p_pool, static_cast<uint32_t>(labels.size()));
+  labels.visit_ids([&p_pool](const LabelId & p_label, const auto & p_value) {
+    append_u32(p_pool, p_label.Id());
+    append_string(p_pool, p_value);
+  });
+}
+
+bool identity_equal(std::string_view p_identity,
+                    const MetricData & p_metric_data) noexcept
+{
+  const auto & id = p_metric_data.Id();
+  if((read_string(p_identity) != id.Name())
+     || (read_string(p_identity) != id.Location()))
+  {
+    return false;
+  }
+
+  const auto & labels = p_metric_data.Labels();
+  if(read_u32(p_identity) != labels.size())
+  {
+    return false;
+  }
+
+  // Labels are visited in id order, as they were encoded.
+  bool equal = true;
+  labels.visit_ids([&p_identity, &equal](const LabelId & p_label, const auto & p_value) {
+    equal = equal
+            && (read_u32(p_identity) == p_label.Id())
+            && (read_string(p_identity) == p_value);
+  });
+
+  return equal;
+}
+
+void decode_identity(std::string_view p_identity,
+                     MetricData & p_metric_data)
+{
+  const auto name = read_string(p_identity);
+  const auto location = read_string(p_identity);
+  p_metric_data.Id(MetricId{name, location});
+
+  auto & labels = p_metric_data.Labels();
+  labels.clear(yy_data::ClearAction::Keep);
+
+  const auto num_labels = read_u32(p_identity);
+  for(uint32_t idx = 0; idx < num_labels; ++idx)
+  {
+    const LabelId label{read_u32(p_identity)};
+    const auto value = read_string(p_identity);
+    labels.set_label(label, value);
+  }
+}
+
+} // namespace series_table_detail
+} // namespace yafiyogi::yy_values
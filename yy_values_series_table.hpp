@@ -0,0 +1,315 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "yy_cpp/yy_clear_action.h"
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_values_metric_data.hpp"
+
+namespace yafiyogi::yy_values {
+namespace series_table_detail {
+
+inline constexpr size_type min_entries = 16;
+
+[[nodiscard]]
+size_type entry_capacity(size_type p_series) noexcept;
+
+[[nodiscard]]
+uint64_t series_key(const MetricData & p_metric_data) noexcept;
+
+// A series' identity is its name, location and labels, each string
+// prefixed by its 32-bit length, with the label count before the
+// labels. A label is stored as its 32-bit LabelId and its value.
+void encode_identity(const MetricData & p_metric_data,
+                     std::string & p_pool);
+
+[[nodiscard]]
+bool identity_equal(std::string_view p_identity,
+                    const MetricData & p_metric_data) noexcept;
+
+void decode_identity(std::string_view p_identity,
+                     MetricData & p_metric_data);
+
+} // namespace series_table_detail
+
+// Per series (MetricId + Labels) state in one open addressing table
+// with linear probing. Entries are fixed size; each series' identity
+// is packed once into a shared string pool. A series is found by its
+// 64-bit hash and confirmed against its identity, so colliding series
+// never share an entry.
+//
+// Tables only grow when more than half full after erasing the entries
+// a caller's predicate rejects, so callers can bound them by age.
+// Erasing rebuilds the table and compacts the pool into spare buffers
+// kept between rebuilds.
+template<typename Payload>
+class SeriesTable final
+{
+  public:
+    struct Found
+    {
+        Payload & payload;
+        bool added = false;
+    };
+
+    explicit SeriesTable(size_type p_series)
+    {
+      reset(series_table_detail::entry_capacity(p_series));
+    }
+
+    SeriesTable() noexcept = default;
+    SeriesTable(const SeriesTable &) = default;
+    SeriesTable(SeriesTable &&) noexcept = default;
+
+    SeriesTable & operator=(const SeriesTable &) = default;
+    SeriesTable & operator=(SeriesTable &&) noexcept = default;
+
+    // Returns p_metric_data's series, adding it with a default payload
+    // if new. When the table is full, entries for which p_expired
+    // returns true are erased first.
+    template<typename Expired>
+    [[nodiscard]]
+    Found find_or_add(const MetricData & p_metric_data,
+                      Expired && p_expired)
+    {
+      const uint64_t key = series_table_detail::series_key(p_metric_data);
+
+      if(auto * entry = find(key, p_metric_data);
+         nullptr != entry)
+      {
+        return Found{entry->payload, false};
+      }
+
+      if(((m_size + 1) * 4) > (m_entries.size() * 3))
+      {
+        std::ignore = erase_if(p_expired);
+
+        if((m_size * 2) >= m_entries.size())
+        {
+          rebuild(std::max(series_table_detail::min_entries, m_entries.size() * 2),
+                  [](const Payload &) { return false; });
+        }
+      }
+
+      auto & entry = m_entries[probe(key)];
+      entry.key = key;
+      entry.used = true;
+      entry.identity_offset = m_pool.size();
+      series_table_detail::encode_identity(p_metric_data, m_pool);
+      entry.identity_size = m_pool.size() - entry.identity_offset;
+      ++m_size;
+
+      return Found{entry.payload, true};
+    }
+
+    [[nodiscard]]
+    Found find_or_add(const MetricData & p_metric_data)
+    {
+      return find_or_add(p_metric_data, [](const Payload &) { return false; });
+    }
+
+    // Returns the number of entries erased.
+    template<typename Predicate>
+    size_type erase_if(Predicate && p_predicate)
+    {
+      size_type num_erased = 0;
+      for(const auto & entry : m_entries)
+      {
+        if(entry.used && p_predicate(entry.payload))
+        {
+          ++num_erased;
+        }
+      }
+
+      if(0 != num_erased)
+      {
+        rebuild(m_entries.size(), p_predicate);
+      }
+
+      return num_erased;
+    }
+
+    // Visitor is called with (Payload &, std::string_view identity).
+    // Decode the identity with decode().
+    template<typename Visitor>
+    void visit(Visitor && p_visitor)
+    {
+      for(auto & entry : m_entries)
+      {
+        if(entry.used)
+        {
+          p_visitor(entry.payload, identity(entry));
+        }
+      }
+    }
+
+    static void decode(std::string_view p_identity,
+                       MetricData & p_metric_data)
+    {
+      series_table_detail::decode_identity(p_identity, p_metric_data);
+    }
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+      return m_size;
+    }
+
+    void clear() noexcept
+    {
+      for(auto & entry : m_entries)
+      {
+        entry = Entry{};
+      }
+
+      m_pool.clear();
+      m_size = 0;
+    }
+
+  private:
+    struct Entry
+    {
+        uint64_t key = 0;
+        uint64_t identity_offset = 0;
+        uint64_t identity_size = 0;
+        bool used = false;
+        Payload payload{};
+    };
+
+    using Entries = yy_quad::simple_vector<Entry>;
+
+    [[nodiscard]]
+    std::string_view identity(const Entry & p_entry) const noexcept
+    {
+      return std::string_view{m_pool}.substr(p_entry.identity_offset, p_entry.identity_size);
+    }
+
+    [[nodiscard]]
+    Entry * find(uint64_t p_key,
+                 const MetricData & p_metric_data) noexcept
+    {
+      if(m_entries.empty())
+      {
+        return nullptr;
+      }
+
+      for(uint64_t idx = p_key & m_mask; m_entries[idx].used; idx = (idx + 1) & m_mask)
+      {
+        auto & entry = m_entries[idx];
+
+        if((p_key == entry.key)
+           && series_table_detail::identity_equal(identity(entry), p_metric_data))
+        {
+          return &entry;
+        }
+      }
+
+      return nullptr;
+    }
+
+    // First free entry for p_key. The table is never full.
+    [[nodiscard]]
+    uint64_t probe(uint64_t p_key) const noexcept
+    {
+      uint64_t idx = p_key & m_mask;
+      while(m_entries[idx].used)
+      {
+        idx = (idx + 1) & m_mask;
+      }
+
+      return idx;
+    }
+
+    void reset(size_type p_capacity)
+    {
+      Entries entries{};
+      entries.reserve(p_capacity);
+      for(size_type idx = 0; idx < p_capacity; ++idx)
+      {
+        entries.emplace_back();
+      }
+
+      m_entries = std::move(entries);
+      m_mask = p_capacity - 1;
+    }
+
+    template<typename Predicate>
+    void rebuild(size_type p_capacity,
+                 Predicate && p_predicate)
+    {
+      m_spare.clear(yy_data::ClearAction::Keep);
+      m_spare_pool.clear();
+
+      for(auto & entry : m_entries)
+      {
+        if(entry.used && !p_predicate(entry.payload))
+        {
+          const auto offset = m_spare_pool.size();
+          m_spare_pool.append(identity(entry));
+          entry.identity_offset = offset;
+          m_spare.emplace_back(std::move(entry));
+        }
+      }
+
+      if(p_capacity != m_entries.size())
+      {
+        reset(p_capacity);
+      }
+      else
+      {
+        for(auto & entry : m_entries)
+        {
+          entry = Entry{};
+        }
+      }
+
+      std::swap(m_pool, m_spare_pool);
+      m_size = m_spare.size();
+
+      for(auto & entry : m_spare)
+      {
+        m_entries[probe(entry.key)] = std::move(entry);
+      }
+    }
+
+    Entries m_entries{};
+    uint64_t m_mask = 0;
+    size_type m_size = 0;
+    std::string m_pool{};
+    Entries m_spare{};
+    std::string m_spare_pool{};
+};
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,636 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "spdlog/spdlog.h"
+#include "yaml-cpp/yaml.h"
+
+#include "yy_configure_values.hpp"
+#include "yy_values_hash.hpp"
+
+#include "yy_values_snapshot.hpp"
+
+namespace yafiyogi::yy_values {
+
+using namespace std::string_view_literals;
+
+namespace {
+
+constexpr const char snapshot_magic[4] = {'Y', 'Y', 'V', 'S'};
+
+struct SnapshotHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint64_t source_hash;
+    uint64_t payload_size;
+    uint64_t payload_hash;
+};
+
+static_assert(std::is_trivially_copyable_v<SnapshotHeader>);
+
+enum class FormatElement:uint8_t {Prefix, Level};
+
+class SnapshotWriter
+{
+  public:
+    template<typename T>
+    void write(T p_value)
+    {
+      static_assert(std::is_trivially_copyable_v<T>);
+      m_buffer.append(reinterpret_cast<const char *>(&p_value), sizeof(T));
+    }
+
+    void write(std::string_view p_str)
+    {
+      write(static_cast<uint32_t>(p_str.size()));
+      m_buffer.append(p_str);
+    }
+
+    void write(const ReplacePathSpecs & p_specs)
+    {
+      write(static_cast<uint32_t>(p_specs.size()));
+      for(const auto & spec : p_specs)
+      {
+        write(std::string_view{spec.pattern});
+        write(static_cast<uint32_t>(spec.format.size()));
+        for(const auto & element : spec.format)
+        {
+          if(const auto * prefix = std::get_if<FormatPrefix>(&element);
+             nullptr != prefix)
+          {
+            write(FormatElement::Prefix);
+            write(std::string_view{prefix->Prefix()});
+          }
+          else
+          {
+            const auto & level = std::get<FormatLevel>(element);
+            write(FormatElement::Level);
+            write(std::string_view{level.Prefix()});
+            write(level.Index());
+          }
+        }
+      }
+    }
+
+    void write(const MetricSpec & p_spec)
+    {
+      write(std::string_view{p_spec.handler_id});
+      write(std::string_view{p_spec.value_id});
+      write(std::string_view{p_spec.property});
+      write(p_spec.location);
+
+      write(static_cast<uint32_t>(p_spec.label_actions.size()));
+      for(const auto & action : p_spec.label_actions)
+      {
+        write(action.op);
+        write(std::string_view{action.source});
+        write(std::string_view{action.target});
+        write(action.replace);
+      }
+
+      write(static_cast<uint32_t>(p_spec.value_actions.size()));
+      for(const auto & action : p_spec.value_actions)
+      {
+        write(action.op);
+        write(std::string_view{action.default_value});
+        write(static_cast<uint32_t>(action.mappings.size()));
+        for(const auto & [input, output] : action.mappings)
+        {
+          write(std::string_view{input});
+          write(std::string_view{output});
+        }
+        write(static_cast<uint32_t>(action.ranges.size()));
+        for(const auto & range : action.ranges)
+        {
+          write(range.below);
+          write(std::string_view{range.output});
+        }
+        write(static_cast<uint32_t>(action.steps.size()));
+        for(const auto & step : action.steps)
+        {
+          write(step.op);
+          write(step.a);
+          write(step.b);
+        }
+      }
+
+      write(p_spec.dedup.mode);
+      write(static_cast<int64_t>(p_spec.dedup.heartbeat.count()));
+      write(static_cast<int64_t>(p_spec.dedup.expiry.count()));
+      write(p_spec.rate.mode);
+      write(static_cast<uint64_t>(p_spec.rate.series));
+      write(static_cast<int64_t>(p_spec.rate.expiry.count()));
+      write(static_cast<uint64_t>(p_spec.cache_capacity));
+      write(p_spec.fingerprint);
+    }
+
+    const std::string & buffer() const noexcept
+    {
+      return m_buffer;
+    }
+
+  private:
+    std::string m_buffer{};
+};
+
+// Every read is bounds checked; the first failure sticks so callers
+// check ok() once at the end.
+class SnapshotReader
+{
+  public:
+    SnapshotReader(std::string_view p_data) noexcept:
+      m_data(p_data)
+    {
+    }
+
+    template<typename T>
+    bool read(T & p_value) noexcept
+    {
+      static_assert(std::is_trivially_copyable_v<T>);
+      if(!m_ok || (m_data.size() < sizeof(T)))
+      {
+        m_ok = false;
+        return false;
+      }
+
+      std::memcpy(&p_value, m_data.data(), sizeof(T));
+      m_data.remove_prefix(sizeof(T));
+      return true;
+    }
+
+    bool read(std::string & p_str)
+    {
+      uint32_t size = 0;
+      if(!read(size) || (m_data.size() < size))
+      {
+        m_ok = false;
+        return false;
+      }
+
+      p_str.assign(m_data.substr(0, size));
+      m_data.remove_prefix(size);
+      return true;
+    }
+
+    // Guards reserve() against corrupt counts; every entry is at least
+    // one byte.
+    bool read_count(uint32_t & p_count) noexcept
+    {
+      if(read(p_count) && (p_count > m_data.size()))
+      {
+        m_ok = false;
+      }
+
+      return m_ok;
+    }
+
+    bool read(ReplacePathSpecs & p_specs)
+    {
+      uint32_t num_specs = 0;
+      if(!read_count(num_specs))
+      {
+        return false;
+      }
+
+      p_specs.reserve(num_specs);
+      for(uint32_t spec_idx = 0; m_ok && (spec_idx < num_specs); ++spec_idx)
+      {
+        ReplacePathSpec spec{};
+        uint32_t num_elements = 0;
+
+        if(read(spec.pattern) && read_count(num_elements))
+        {
+          spec.format.reserve(num_elements);
+          for(uint32_t element_idx = 0; m_ok && (element_idx < num_elements); ++element_idx)
+          {
+            FormatElement type{};
+            std::string prefix{};
+
+            if(read(type) && read(prefix))
+            {
+              switch(type)
+              {
+                case FormatElement::Prefix:
+                  spec.format.emplace_back(std::in_place_type_t<FormatPrefix>{}, prefix);
+                  break;
+
+                case FormatElement::Level:
+                {
+                  FormatLevel::size_type idx = 0;
+                  if(read(idx))
+                  {
+                    spec.format.emplace_back(std::in_place_type_t<FormatLevel>{}, prefix, idx);
+                  }
+                }
+                break;
+
+                default:
+                  m_ok = false;
+                  break;
+              }
+            }
+          }
+        }
+
+        p_specs.emplace_back(std::move(spec));
+      }
+
+      return m_ok;
+    }
+
+    bool read(MetricSpec & p_spec)
+    {
+      if(!read(p_spec.handler_id)
+         || !read(p_spec.value_id)
+         || !read(p_spec.property)
+         || !read(p_spec.location))
+      {
+        return false;
+      }
+
+      uint32_t num_label_actions = 0;
+      if(read_count(num_label_actions))
+      {
+        p_spec.label_actions.reserve(num_label_actions);
+        for(uint32_t idx = 0; m_ok && (idx < num_label_actions); ++idx)
+        {
+          LabelActionSpec action{};
+          if(read(action.op)
+             && read(action.source)
+             && read(action.target)
+             && read(action.replace))
+          {
+            m_ok = action.op <= LabelOpCode::ReplacePath;
+          }
+          p_spec.label_actions.emplace_back(std::move(action));
+        }
+      }
+
+      uint32_t num_value_actions = 0;
+      if(read_count(num_value_actions))
+      {
+        p_spec.value_actions.reserve(num_value_actions);
+        for(uint32_t idx = 0; m_ok && (idx < num_value_actions); ++idx)
+        {
+          ValueActionSpec action{};
+          uint32_t num_mappings = 0;
+          if(read(action.op)
+             && read(action.default_value)
+             && read_count(num_mappings))
+          {
+            m_ok = action.op <= ValueOpCode::Transform;
+            action.mappings.reserve(num_mappings);
+            for(uint32_t mapping_idx = 0; m_ok && (mapping_idx < num_mappings); ++mapping_idx)
+            {
+              std::string input{};
+              std::string output{};
+              if(read(input) && read(output))
+              {
+                action.mappings.emplace_back(std::move(input), std::move(output));
+              }
+            }
+          }
+
+          uint32_t num_ranges = 0;
+          if(read_count(num_ranges))
+          {
+            action.ranges.reserve(num_ranges);
+            for(uint32_t range_idx = 0; m_ok && (range_idx < num_ranges); ++range_idx)
+            {
+              RangeValueAction::Range range{};
+              if(read(range.below) && read(range.output))
+              {
+                action.ranges.emplace_back(std::move(range));
+              }
+            }
+          }
+
+          uint32_t num_steps = 0;
+          if(read_count(num_steps))
+          {
+            action.steps.reserve(num_steps);
+            for(uint32_t step_idx = 0; m_ok && (step_idx < num_steps); ++step_idx)
+            {
+              TransformStep step{};
+              if(read(step.op) && read(step.a) && read(step.b))
+              {
+                m_ok = step.op <= TransformOp::Round;
+                action.steps.emplace_back(step);
+              }
+            }
+          }
+          p_spec.value_actions.emplace_back(std::move(action));
+        }
+      }
+
+      int64_t heartbeat = 0;
+      int64_t dedup_expiry = 0;
+      uint64_t rate_series = 0;
+      int64_t rate_expiry = 0;
+      uint64_t cache_capacity = 0;
+      if(read(p_spec.dedup.mode)
+         && read(heartbeat)
+         && read(dedup_expiry)
+         && read(p_spec.rate.mode)
+         && read(rate_series)
+         && read(rate_expiry)
+         && read(cache_capacity)
+         && read(p_spec.fingerprint))
+      {
+        m_ok = (p_spec.dedup.mode <= DedupMode::Mark)
+               && (p_spec.rate.mode <= RateMode::Rate);
+        p_spec.dedup.heartbeat = std::chrono::nanoseconds{heartbeat};
+        p_spec.dedup.expiry = std::chrono::nanoseconds{dedup_expiry};
+        p_spec.rate.series = static_cast<size_type>(rate_series);
+        p_spec.rate.expiry = std::chrono::nanoseconds{rate_expiry};
+        p_spec.cache_capacity = static_cast<size_type>(cache_capacity);
+      }
+
+      return m_ok;
+    }
+
+    bool ok() const noexcept
+    {
+      return m_ok;
+    }
+
+    bool empty() const noexcept
+    {
+      return m_data.empty();
+    }
+
+  private:
+    std::string_view m_data{};
+    bool m_ok = true;
+};
+
+bool write_all(int p_fd,
+               const char * p_data,
+               size_t p_size) noexcept
+{
+  while(p_size > 0)
+  {
+    const auto written = ::write(p_fd, p_data, p_size);
+    if(written < 0)
+    {
+      if(EINTR == errno)
+      {
+        continue;
+      }
+      return false;
+    }
+
+    p_data += written;
+    p_size -= static_cast<size_t>(written);
+  }
+
+  return true;
+}
+
+class MappedFile
+{
+  public:
+    MappedFile(const std::string & p_filename) noexcept
+    {
+      if(m_fd = ::open(p_filename.c_str(), O_RDONLY | O_CLOEXEC);
+         -1 != m_fd)
+      {
+        if(struct stat file_stat{};
+           (0 == ::fstat(m_fd, &file_stat)) && (file_stat.st_size > 0))
+        {
+          if(void * addr = ::mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, m_fd, 0);
+             MAP_FAILED != addr)
+          {
+            m_data = std::string_view{static_cast<const char *>(addr), static_cast<size_t>(file_stat.st_size)};
+          }
+        }
+      }
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    ~MappedFile() noexcept
+    {
+      if(!m_data.empty())
+      {
+        ::munmap(const_cast<char *>(m_data.data()), m_data.size());
+      }
+
+      if(-1 != m_fd)
+      {
+        ::close(m_fd);
+      }
+    }
+
+    std::string_view data() const noexcept
+    {
+      return m_data;
+    }
+
+  private:
+    int m_fd = -1;
+    std::string_view m_data{};
+};
+
+} // anonymous namespace
+
+uint64_t snapshot_source_hash(std::string_view p_source) noexcept
+{
+  return hash_combine(hash_string(p_source), snapshot_version);
+}
+
+bool save_snapshot(const std::string & p_filename,
+                   const MetricSpecs & p_specs,
+                   uint64_t p_source_hash)
+{
+  SnapshotWriter writer{};
+  writer.write(static_cast<uint32_t>(p_specs.size()));
+  for(const auto & spec : p_specs)
+  {
+    writer.write(spec);
+  }
+
+  const auto & payload = writer.buffer();
+  SnapshotHeader header{};
+  std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+  header.version = snapshot_version;
+  header.source_hash = p_source_hash;
+  header.payload_size = payload.size();
+  header.payload_hash = hash_string(payload);
+
+  // Write aside, sync and rename so readers never see a partial
+  // snapshot, even after a crash.
+  const std::string tmp_filename{p_filename + ".tmp"};
+  std::error_code ec{};
+  {
+    const int fd = ::open(tmp_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if(-1 == fd)
+    {
+      spdlog::warn("Failed to create snapshot [{}]."sv, tmp_filename);
+      return false;
+    }
+
+    bool written = write_all(fd, reinterpret_cast<const char *>(&header), sizeof(header))
+                   && write_all(fd, payload.data(), payload.size())
+                   && (0 == ::fsync(fd));
+    written = (0 == ::close(fd)) && written;
+
+    if(!written)
+    {
+      spdlog::warn("Failed to write snapshot [{}]."sv, tmp_filename);
+      std::filesystem::remove(tmp_filename, ec);
+      return false;
+    }
+  }
+
+  std::filesystem::rename(tmp_filename, p_filename, ec);
+  if(ec)
+  {
+    spdlog::warn("Failed to rename snapshot [{}]: {}."sv, p_filename, ec.message());
+    return false;
+  }
+
+  return true;
+}
+
+std::optional<MetricSpecs> load_snapshot(const std::string & p_filename,
+                                         uint64_t p_source_hash)
+{
+  const MappedFile file{p_filename};
+  std::string_view data{file.data()};
+
+  SnapshotHeader header{};
+  if(data.size() < sizeof(header))
+  {
+    return std::nullopt;
+  }
+
+  std::memcpy(&header, data.data(), sizeof(header));
+  data.remove_prefix(sizeof(header));
+
+  if((0 != std::memcmp(header.magic, snapshot_magic, sizeof(header.magic)))
+     || (snapshot_version != header.version)
+     || (p_source_hash != header.source_hash))
+  {
+    spdlog::info("Snapshot [{}] is stale."sv, p_filename);
+    return std::nullopt;
+  }
+
+  if((data.size() != header.payload_size)
+     || (hash_string(data) != header.payload_hash))
+  {
+    spdlog::warn("Snapshot [{}] is corrupt."sv, p_filename);
+    return std::nullopt;
+  }
+
+  SnapshotReader reader{data};
+  MetricSpecs specs{};
+  uint32_t num_specs = 0;
+
+  if(reader.read_count(num_specs))
+  {
+    specs.reserve(num_specs);
+    for(uint32_t idx = 0; reader.ok() && (idx < num_specs); ++idx)
+    {
+      MetricSpec spec{};
+      if(reader.read(spec))
+      {
+        specs.emplace_back(std::move(spec));
+      }
+    }
+  }
+
+  if(!reader.ok() || !reader.empty())
+  {
+    spdlog::warn("Snapshot [{}] is malformed."sv, p_filename);
+    return std::nullopt;
+  }
+
+  return specs;
+}
+
+MetricsMap load_values(const std::string & p_config_file,
+                       const std::string & p_snapshot_file,
+                       std::string_view p_values_key)
+{
+  std::string source{};
+  {
+    std::ifstream in{p_config_file, std::ios::binary};
+    if(!in)
+    {
+      spdlog::error("Failed to open config [{}]."sv, p_config_file);
+      return MetricsMap{};
+    }
+
+    source.assign(std::istreambuf_iterator<char>{in},
+                  std::istreambuf_iterator<char>{});
+
+    if(in.bad())
+    {
+      spdlog::error("Failed to read config [{}]."sv, p_config_file);
+      return MetricsMap{};
+    }
+  }
+
+  const uint64_t source_hash = hash_combine(snapshot_source_hash(source),
+                                            hash_string(p_values_key));
+
+  if(auto specs{load_snapshot(p_snapshot_file, source_hash)};
+     specs.has_value())
+  {
+    spdlog::info("Configuring values from snapshot [{}]."sv, p_snapshot_file);
+    return create_metrics(specs.value());
+  }
+
+  const YAML::Node yaml_config{YAML::Load(source)};
+  auto specs{configure_metric_specs(p_values_key.empty()
+                                    ? yaml_config
+                                    : yaml_config[std::string{p_values_key}])};
+
+  if(save_snapshot(p_snapshot_file, specs, source_hash))
+  {
+    spdlog::info("Saved snapshot [{}]."sv, p_snapshot_file);
+  }
+
+  return create_metrics(specs);
+}
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,65 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "yy_values_metric.hpp"
+#include "yy_values_metric_spec.hpp"
+
+namespace yafiyogi::yy_values {
+
+// A snapshot holds MetricSpecs in a flat binary form so start up can
+// skip YAML and format parsing. It is a host-local cache: integers are
+// stored in native byte order and the header records the hash of the
+// configuration it was built from. Any mismatch, including a new
+// snapshot_version, makes it stale.
+inline constexpr uint32_t snapshot_version = 7;
+
+uint64_t snapshot_source_hash(std::string_view p_source) noexcept;
+
+bool save_snapshot(const std::string & p_filename,
+                   const MetricSpecs & p_specs,
+                   uint64_t p_source_hash);
+
+// Returns std::nullopt if the snapshot is missing, stale or corrupt.
+std::optional<MetricSpecs> load_snapshot(const std::string & p_filename,
+                                         uint64_t p_source_hash);
+
+// Builds Metrics from p_snapshot_file when it matches p_config_file,
+// otherwise configures them from the YAML node p_values_key (or the
+// document root when empty) and rewrites the snapshot. If
+// p_config_file can't be read an error is logged, no snapshot is
+// written and no Metrics are returned.
+MetricsMap load_values(const std::string & p_config_file,
+                       const std::string & p_snapshot_file,
+                       std::string_view p_values_key);
+
+} // namespace yafiyogi::yy_values
@@ -0,0 +1,68 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <algorithm>
+
+#include "yy_values_stats.hpp"
+
+namespace yafiyogi::yy_values {
+namespace {
+
+void merge_actions(ActionSnapshots & p_actions,
+                   const ActionSnapshots & p_other)
+{
+  if(p_actions.empty())
+  {
+    p_actions = p_other;
+    return;
+  }
+
+  // Snapshots of the same Metric have the same actions in the same order.
+  const size_type l_size = std::min(p_actions.size(), p_other.size());
+
+  for(size_type idx = 0; idx < l_size; ++idx)
+  {
+    p_actions[idx].calls += p_other[idx].calls;
+    p_actions[idx].misses += p_other[idx].misses;
+  }
+}
+
+} // anonymous namespace
+
+void MetricStatsSnapshot::merge(const MetricStatsSnapshot & p_other)
+{
+  events += p_other.events;
+  unchanged += p_other.unchanged;
+  rate_resets += p_other.rate_resets;
+  rate_unparsed += p_other.rate_unparsed;
+  rate_stale += p_other.rate_stale;
+  event_latency.merge(p_other.event_latency);
+  merge_actions(property_actions, p_other.property_actions);
+  merge_actions(label_actions, p_other.label_actions);
+  merge_actions(value_actions, p_other.value_actions);
+}
+
+} // namespace yafiyogi::yy_values
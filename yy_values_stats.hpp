@@ -0,0 +1,230 @@
+/*
+
+  MIT License
+
+  Copyright (c) 2026 Yafiyogi
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <string_view>
+
+#include "yy_cpp/yy_types.hpp"
+#include "yy_cpp/yy_vector.h"
+
+#include "yy_values_label_id.hpp"
+
+namespace yafiyogi::yy_values {
+
+// Hot path instrumentation is compiled in with -DYY_VALUES_STATS
+// (cmake -DYY_VALUES_STATS=ON). When disabled the counters below are
+// empty and every update is a no-op.
+#if defined(YY_VALUES_STATS)
+inline constexpr bool g_stats_enabled = true;
+#else
+inline constexpr bool g_stats_enabled = false;
+#endif
+
+namespace stats_detail {
+
+// Latency buckets are powers of two nanoseconds; bucket n counts
+// samples in [2^(n-1), 2^n), the last bucket counts everything above.
+inline constexpr size_type latency_buckets = 32;
+
+} // namespace stats_detail
+
+// Counter written by a single thread and read by any thread. Each
+// MetricContext is owned by one thread, so updates are a relaxed
+// load and store rather than a locked read-modify-write.
+#if defined(YY_VALUES_STATS)
+class StatCounter final
+{
+  public:
+    constexpr StatCounter() noexcept = default;
+    StatCounter(const StatCounter & p_other) noexcept:
+      m_value(p_other.value())
+    {
+    }
+
+    StatCounter & operator=(const StatCounter & p_other) noexcept
+    {
+      m_value.store(p_other.value(), std::memory_order_relaxed);
+      return *this;
+    }
+
+    void add(uint64_t p_value) noexcept
+    {
+      m_value.store(m_value.load(std::memory_order_relaxed) + p_value,
+                    std::memory_order_relaxed);
+    }
+
+    void inc() noexcept
+    {
+      add(1);
+    }
+
+    [[nodiscard]]
+    uint64_t value() const noexcept
+    {
+      return m_value.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<uint64_t> m_value{0};
+};
+#else
+class StatCounter final
+{
+  public:
+    constexpr void add(uint64_t /* p_value */) noexcept
+    {
+    }
+
+    constexpr void inc() noexcept
+    {
+    }
+
+    [[nodiscard]]
+    constexpr uint64_t value() const noexcept
+    {
+      return 0;
+    }
+};
+#endif
+
+using StatCounters = yy_quad::simple_vector<StatCounter>;
+
+struct LatencySnapshot
+{
+    std::array<uint64_t, stats_detail::latency_buckets> buckets{};
+    uint64_t count = 0;
+    uint64_t sum_ns = 0;
+
+    void merge(const LatencySnapshot & p_other) noexcept
+    {
+      for(size_type idx = 0; idx < buckets.size(); ++idx)
+      {
+        buckets[idx] += p_other.buckets[idx];
+      }
+      count += p_other.count;
+      sum_ns += p_other.sum_ns;
+    }
+};
+
+class LatencyHistogram final
+{
+  public:
+    void record(uint64_t p_ns) noexcept
+    {
+      if constexpr(g_stats_enabled)
+      {
+        const auto bucket = std::min(static_cast<size_type>(std::bit_width(p_ns)),
+                                     stats_detail::latency_buckets - 1);
+
+        m_buckets[bucket].inc();
+        m_count.inc();
+        m_sum_ns.add(p_ns);
+      }
+    }
+
+    [[nodiscard]]
+    LatencySnapshot snapshot() const noexcept
+    {
+      LatencySnapshot l_snapshot{};
+
+      for(size_type idx = 0; idx < l_snapshot.buckets.size(); ++idx)
+      {
+        l_snapshot.buckets[idx] = m_buckets[idx].value();
+      }
+      l_snapshot.count = m_count.value();
+      l_snapshot.sum_ns = m_sum_ns.value();
+
+      return l_snapshot;
+    }
+
+  private:
+    std::array<StatCounter, stats_detail::latency_buckets> m_buckets{};
+    StatCounter m_count{};
+    StatCounter m_sum_ns{};
+};
+
+// Counters for one compiled action. misses counts replace-path
+// topics with no matching pattern, and value actions that fell back
+// to their default (e.g. a switch with no matching case).
+struct ActionStats
+{
+    StatCounter calls{};
+    StatCounter misses{};
+};
+
+using ActionStatsVector = yy_quad::simple_vector<ActionStats>;
+
+struct ActionSnapshot
+{
+    std::string_view name{};
+    LabelId target{};
+    uint64_t calls = 0;
+    uint64_t misses = 0;
+};
+
+using ActionSnapshots = yy_quad::simple_vector<ActionSnapshot>;
+
+// Counters kept in a MetricContext, so they are per thread.
+struct MetricStats
+{
+    StatCounter events{};
+    StatCounter unchanged{};
+    StatCounter rate_resets{};
+    StatCounter rate_unparsed{};
+    StatCounter rate_stale{};
+    LatencyHistogram event_latency{};
+    ActionStatsVector property_actions{};
+    ActionStatsVector label_actions{};
+    ActionStatsVector value_actions{};
+};
+
+// Plain copy of a MetricContext's counters, safe to export or merge
+// across the contexts of several threads.
+struct MetricStatsSnapshot
+{
+    uint64_t events = 0;
+    uint64_t unchanged = 0;
+    // Counter resets seen, and samples a rate metric dropped because
+    // the value did not parse or (Rate mode) the timestamp did not
+    // advance.
+    uint64_t rate_resets = 0;
+    uint64_t rate_unparsed = 0;
+    uint64_t rate_stale = 0;
+    LatencySnapshot event_latency{};
+    ActionSnapshots property_actions{};
+    ActionSnapshots label_actions{};
+    ActionSnapshots value_actions{};
+
+    void merge(const MetricStatsSnapshot & p_other);
+};
+
+} // namespace yafiyogi::yy_values